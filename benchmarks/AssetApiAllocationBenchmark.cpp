@@ -0,0 +1,257 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// Counts heap allocations, and bytes allocated, per call of each
+// AssetAPI entry point, driving the plugin against the mock manager so
+// that only the plugin's (and OpenAssetIO's) own allocations are
+// measured. Allocations are counted by replacing the global operator
+// new, so memory allocated directly with malloc (e.g. by Python) is
+// not included.
+//
+// Usage: katanaopenassetio-bench-allocations [numCalls]
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <FnAsset/plugin/FnAsset.h>
+#include <FnAsset/suite/FnAssetSuite.h>
+
+#include "Constants.hpp"
+#include "MockManagerInterface.hpp"
+#include "OpenAssetIOAsset.hpp"
+
+namespace
+{
+std::atomic<std::uint64_t> gAllocations{0};
+std::atomic<std::uint64_t> gAllocatedBytes{0};
+
+void* countedAlloc(const std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+}  // namespace
+
+void* operator new(const std::size_t size)
+{
+    return countedAlloc(size);
+}
+
+void* operator new[](const std::size_t size)
+{
+    return countedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+constexpr std::size_t kNumWarmUpCalls = 100;
+
+struct Case
+{
+    const char* name;
+    // Called with the index of the call.
+    std::function<void(std::size_t)> call;
+};
+
+void runCase(const Case& benchCase, const std::size_t numCalls)
+{
+    for (std::size_t idx = 0; idx < kNumWarmUpCalls; ++idx)
+    {
+        benchCase.call(idx);
+    }
+
+    const std::uint64_t allocationsBefore = gAllocations.load();
+    const std::uint64_t bytesBefore = gAllocatedBytes.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t idx = 0; idx < numCalls; ++idx)
+    {
+        benchCase.call(kNumWarmUpCalls + idx);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const auto perCall = [numCalls](const std::uint64_t total)
+    { return static_cast<double>(total) / static_cast<double>(numCalls); };
+    std::printf("%-44s %12.1f %14.1f %12.0f\n",
+                benchCase.name,
+                perCall(gAllocations.load() - allocationsBefore),
+                perCall(gAllocatedBytes.load() - bytesBefore),
+                perCall(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())));
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t numCalls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000;
+
+    MockManagerInterface::Options mockOptions;
+    mockOptions.prefix = "mock://";
+    OpenAssetIOAsset asset{[&mockOptions](const auto& hostInterface, const auto& logger)
+                           { return MockManagerInterface::makeManager(
+                                 mockOptions, hostInterface, logger); }};
+
+    // Distinct IDs, for calls that would otherwise be answered from
+    // cache after the first.
+    std::vector<std::string> uniqueIds;
+    uniqueIds.reserve(kNumWarmUpCalls + numCalls);
+    for (std::size_t idx = 0; idx < kNumWarmUpCalls + numCalls; ++idx)
+    {
+        uniqueIds.push_back("mock://show/seq/shot/asset" + std::to_string(idx));
+    }
+
+    const std::string assetId = "mock://show/seq/shot/asset";
+    const std::string notAssetId = "/mnt/projects/show/seq/shot/asset.abc";
+    const OpenAssetIOAsset::StringMap fields{{Constants::kAssetId, assetId},
+                                             {kFnAssetFieldName, "asset"}};
+    const OpenAssetIOAsset::StringMap versionedFields{
+        {Constants::kAssetId, assetId}, {kFnAssetFieldName, "asset"}, {kFnAssetFieldVersion, "2"}};
+    const OpenAssetIOAsset::StringMap emptyMap;
+
+    const std::vector<Case> cases{
+        {"isAssetId", [&](std::size_t) { asset.isAssetId(assetId); }},
+        {"isAssetId (not an ID)", [&](std::size_t) { asset.isAssetId(notAssetId); }},
+        {"containsAssetId", [&](std::size_t) { asset.containsAssetId(notAssetId); }},
+        {"checkPermissions", [&](std::size_t) { asset.checkPermissions(assetId, emptyMap); }},
+        {"runAssetPluginCommand",
+         [&](std::size_t) { asset.runAssetPluginCommand(assetId, "noop", emptyMap); }},
+        {"resolveAsset (cached)",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.resolveAsset(assetId, ret);
+         }},
+        {"resolveAsset (uncached)",
+         [&](const std::size_t idx)
+         {
+             std::string ret;
+             asset.resolveAsset(uniqueIds[idx], ret);
+         }},
+        {"resolveAllAssets",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.resolveAllAssets(assetId, ret);
+         }},
+        {"resolveAssetVersion",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.resolveAssetVersion(assetId, ret, "");
+         }},
+        {"getUniqueScenegraphLocationFromAssetId",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.getUniqueScenegraphLocationFromAssetId(assetId, true, ret);
+         }},
+        {"getAssetDisplayName",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.getAssetDisplayName(assetId, ret);
+         }},
+        {"getAssetVersions",
+         [&](std::size_t)
+         {
+             OpenAssetIOAsset::StringVector ret;
+             asset.getAssetVersions(assetId, ret);
+         }},
+        {"getRelatedAssetId",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.getRelatedAssetId(assetId, "argsxml", ret);
+         }},
+        {"getAssetFields",
+         [&](std::size_t)
+         {
+             OpenAssetIOAsset::StringMap ret;
+             asset.getAssetFields(assetId, true, ret);
+         }},
+        {"buildAssetId",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.buildAssetId(fields, ret);
+         }},
+        {"buildAssetId (versioned)",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.buildAssetId(versionedFields, ret);
+         }},
+        {"getAssetAttributes",
+         [&](std::size_t)
+         {
+             OpenAssetIOAsset::StringMap ret;
+             asset.getAssetAttributes(assetId, "version", ret);
+         }},
+        {"setAssetAttributes",
+         [&](std::size_t) { asset.setAssetAttributes(assetId, "version", emptyMap); }},
+        {"getAssetIdForScope",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.getAssetIdForScope(assetId, "name", ret);
+         }},
+        {"createAssetAndPath",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.createAssetAndPath(
+                 nullptr, kFnAssetTypeKatanaScene, fields, emptyMap, false, ret);
+         }},
+        {"postCreateAsset",
+         [&](std::size_t)
+         {
+             std::string ret;
+             asset.postCreateAsset(nullptr, kFnAssetTypeKatanaScene, fields, emptyMap, ret);
+         }},
+    };
+
+    std::printf("%-44s %12s %14s %12s\n", "method", "allocs/call", "bytes/call", "ns/call");
+    for (const Case& benchCase : cases)
+    {
+        try
+        {
+            runCase(benchCase, numCalls);
+        }
+        catch (const std::exception& exc)
+        {
+            std::printf("%-44s failed: %s\n", benchCase.name, exc.what());
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// Measures the memory held per entity by EntityCache, over synthetic
+// asset IDs and paths in the layout typical of a show's published
+// asset tree, and the cost of evicting down to a budget.
+//
+// Usage: katanaopenassetio-bench-entitycache [numEntities]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include "EntityCache.hpp"
+
+namespace
+{
+std::string makeAssetId(const std::size_t idx)
+{
+    std::string assetId = "ams:///show_ab/sq";
+    assetId += std::to_string(10 + idx % 40);
+    assetId += "/sh";
+    assetId += std::to_string(1000 + idx % 400);
+    assetId += "/prop";
+    assetId += std::to_string(idx);
+    assetId += "?v=";
+    assetId += std::to_string(1 + idx % 12);
+    return assetId;
+}
+
+std::string makeLocation(const std::size_t idx)
+{
+    std::string location = "/mnt/projects/show_ab/sequences/sq";
+    location += std::to_string(10 + idx % 40);
+    location += "/shots/sh";
+    location += std::to_string(1000 + idx % 400);
+    location += "/assets/prop";
+    location += std::to_string(idx);
+    location += "/v";
+    location += std::to_string(1 + idx % 12);
+    location += "/model.abc";
+    return location;
+}
+
+// Resident set size, in bytes, or zero where unavailable.
+std::size_t residentBytes()
+{
+    std::ifstream statm{"/proc/self/statm"};
+    std::size_t totalPages = 0;
+    std::size_t residentPages = 0;
+    if (!(statm >> totalPages >> residentPages))
+    {
+        return 0;
+    }
+    return residentPages * 4096;
+}
+
+void fill(EntityCache& cache, const std::size_t numEntities, const bool allFields)
+{
+    for (std::size_t idx = 0; idx < numEntities; ++idx)
+    {
+        const std::string assetId = makeAssetId(idx);
+        cache.put(assetId, EntityCache::Field::kLocation, makeLocation(idx));
+        if (allFields)
+        {
+            cache.put(assetId, EntityCache::Field::kDisplayName, "prop" + std::to_string(idx));
+            cache.put(assetId, EntityCache::Field::kVersionTag, "v" + std::to_string(1 + idx % 12));
+        }
+    }
+}
+
+void measure(const char* name, const std::size_t numEntities, const bool allFields)
+{
+    const std::size_t residentBefore = residentBytes();
+    EntityCache cache;
+    const auto start = std::chrono::steady_clock::now();
+    fill(cache, numEntities, allFields);
+    const std::chrono::duration<double> fillTime = std::chrono::steady_clock::now() - start;
+    const std::size_t residentAfter = residentBytes();
+
+    const auto perEntity = [numEntities](const std::size_t bytes)
+    { return static_cast<double>(bytes) / static_cast<double>(numEntities); };
+    std::printf("%-24s %8.1f bytes/entity (%6.1f MB), RSS %8.1f bytes/entity, fill %6.2fs\n",
+                name,
+                perEntity(cache.memoryUsage()),
+                static_cast<double>(cache.memoryUsage()) / 1e6,
+                perEntity(residentAfter - residentBefore),
+                fillTime.count());
+
+    // Evict half, as under a budget.
+    const auto shrinkStart = std::chrono::steady_clock::now();
+    const std::size_t evicted = cache.shrink(cache.memoryUsage() / 2);
+    const std::chrono::duration<double> shrinkTime =
+        std::chrono::steady_clock::now() - shrinkStart;
+    std::printf("%-24s evicted %zu of %zu values in %6.3fs, leaving %6.1f MB\n",
+                "",
+                evicted,
+                evicted + cache.size(),
+                shrinkTime.count(),
+                static_cast<double>(cache.memoryUsage()) / 1e6);
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t numEntities = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::printf("%zu entities\n", numEntities);
+    measure("location", numEntities, false);
+    measure("location, name, version", numEntities, true);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// Measures the time and resident memory taken to load each of the
+// given shared libraries, in order, as Katana would load the plugin
+// (and, when Python managers are enabled, the Python bridge module).
+// Run once per configuration, since a library's dependencies are only
+// loaded by the first library that needs them. For example, without and
+// with Python managers:
+//
+//   katanaopenassetio-bench-load Libs/KatanaOpenAssetIOPlugin.so
+//   katanaopenassetio-bench-load Libs/KatanaOpenAssetIOPlugin.so
+//       lib/KatanaOpenAssetIOPythonBridge.so
+//
+// Usage: katanaopenassetio-bench-load library...
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include <dlfcn.h>
+#include <unistd.h>
+
+namespace
+{
+// Resident set size, in bytes, or zero where unavailable.
+std::size_t residentBytes()
+{
+    std::ifstream statm{"/proc/self/statm"};
+    std::size_t totalPages = 0;
+    std::size_t residentPages = 0;
+    if (!(statm >> totalPages >> residentPages))
+    {
+        return 0;
+    }
+    return residentPages * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "Usage: %s library...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("%-60s %10s %10s %12s\n", "library", "ms", "RSS KiB", "total KiB");
+    const std::size_t residentAtStart = residentBytes();
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
+    {
+        const std::size_t residentBefore = residentBytes();
+        const auto start = std::chrono::steady_clock::now();
+        // RTLD_NOW, as symbols would otherwise be resolved lazily,
+        // outside of the measurement.
+        if (::dlopen(argv[argIdx], RTLD_NOW | RTLD_LOCAL) == nullptr)
+        {
+            std::fprintf(stderr, "%s\n", ::dlerror());
+            return EXIT_FAILURE;
+        }
+        const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+        const std::size_t residentAfter = residentBytes();
+        std::printf("%-60s %10.2f %10zu %12zu\n",
+                    argv[argIdx],
+                    elapsed.count(),
+                    (residentAfter - residentBefore) / 1024,
+                    (residentAfter - residentAtStart) / 1024);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,235 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// Counts heap allocations, and bytes allocated, per request made
+// through ResolverClient, as the plugin makes them when the resolver
+// daemon is in use. Requests are answered by an in-process responder
+// that reuses its buffers, as the daemon does, so that steady-state
+// allocations are those of the client. Unlike the AssetAPI allocation
+// benchmark, this needs neither Katana nor a manager.
+//
+// Usage: katanaopenassetio-bench-resolver-allocations [numCalls]
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "ResolverClient.hpp"
+#include "ResolverProtocol.hpp"
+
+namespace
+{
+std::atomic<std::uint64_t> gAllocations{0};
+std::atomic<std::uint64_t> gAllocatedBytes{0};
+
+void* countedAlloc(const std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+}  // namespace
+
+void* operator new(const std::size_t size)
+{
+    return countedAlloc(size);
+}
+
+void* operator new[](const std::size_t size)
+{
+    return countedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+constexpr std::size_t kNumWarmUpCalls = 100;
+
+// Into a reused string, so that the responder doesn't allocate.
+void makeLocation(const std::string_view assetId, std::string& location)
+{
+    location = "/mnt/projects/show/sequences/sq010/shots/sh0010/assets/";
+    location += assetId.substr(assetId.rfind('/') + 1);
+    location += "/v3/model.abc";
+}
+
+// Answers location requests on a single connection, as the daemon
+// does, until the client disconnects.
+void respond(const int fd)
+{
+    ResolverProtocol::Header header{};
+    std::string request;
+    std::string response;
+    std::vector<std::string_view> items;
+    std::vector<ResolverProtocol::Result> results;
+    while (ResolverProtocol::ReadMessage(fd, header, request) &&
+           ResolverProtocol::DecodeRequest(header, request, items))
+    {
+        results.resize(items.size());
+        for (std::size_t idx = 0; idx < items.size(); ++idx)
+        {
+            results[idx].status = ResolverProtocol::Status::kOk;
+            makeLocation(items[idx], results[idx].value);
+        }
+        ResolverProtocol::EncodeResults(results, response);
+        if (!ResolverProtocol::WriteMessage(fd, response))
+        {
+            break;
+        }
+    }
+    ::close(fd);
+}
+
+struct Case
+{
+    const char* name;
+    std::function<void()> call;
+};
+
+void runCase(const Case& benchCase, const std::size_t numCalls)
+{
+    for (std::size_t idx = 0; idx < kNumWarmUpCalls; ++idx)
+    {
+        benchCase.call();
+    }
+
+    const std::uint64_t allocationsBefore = gAllocations.load();
+    const std::uint64_t bytesBefore = gAllocatedBytes.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t idx = 0; idx < numCalls; ++idx)
+    {
+        benchCase.call();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const auto perCall = [numCalls](const std::uint64_t total)
+    { return static_cast<double>(total) / static_cast<double>(numCalls); };
+    std::printf("%-44s %12.1f %14.1f %12.0f\n",
+                benchCase.name,
+                perCall(gAllocations.load() - allocationsBefore),
+                perCall(gAllocatedBytes.load() - bytesBefore),
+                perCall(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())));
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t numCalls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000;
+
+    char socketDir[] = "/tmp/katanaopenassetio-bench-XXXXXX";
+    if (::mkdtemp(socketDir) == nullptr)
+    {
+        std::perror("mkdtemp");
+        return EXIT_FAILURE;
+    }
+    const std::string socketPath = std::string{socketDir} + "/resolverd.sock";
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    socketPath.copy(address.sun_path, sizeof(address.sun_path) - 1);
+    const int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0 ||
+        ::bind(listenFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listenFd, 1) != 0)
+    {
+        std::perror("listen");
+        return EXIT_FAILURE;
+    }
+    // The client holds a single idle connection between sequential
+    // requests, so one responder suffices.
+    std::thread responder{[listenFd]
+                          {
+                              if (const int fd = ::accept(listenFd, nullptr, nullptr); fd >= 0)
+                              {
+                                  respond(fd);
+                              }
+                          }};
+
+    std::vector<std::string> assetIds;
+    std::vector<std::string_view> batch;
+    for (std::size_t idx = 0; idx < 64; ++idx)
+    {
+        assetIds.push_back("ams:///show/sq010/sh0010/prop" + std::to_string(idx));
+    }
+    batch.assign(assetIds.begin(), assetIds.end());
+
+    std::printf("%-44s %12s %14s %12s\n", "request", "allocs/call", "bytes/call", "ns/call");
+    {
+        ResolverClient client{socketPath, std::chrono::milliseconds{5000}};
+
+        // As the plugin does, with per-thread scratch vectors.
+        std::vector<std::string_view> scratchIds;
+        std::vector<ResolverProtocol::Result> scratchResults;
+        // As before per-thread scratch vectors were introduced.
+        const auto resolveFresh = [&client](const std::vector<std::string_view>& ids)
+        {
+            std::vector<std::string_view> requestIds{ids.begin(), ids.end()};
+            std::vector<ResolverProtocol::Result> results;
+            client.resolveLocations(requestIds, results);
+        };
+
+        const std::vector<Case> cases{
+            {"resolveLocations x1 (scratch buffers)",
+             [&]
+             {
+                 scratchIds.assign(1, batch.front());
+                 client.resolveLocations(scratchIds, scratchResults);
+             }},
+            {"resolveLocations x1 (per-call buffers)",
+             [&] { resolveFresh({batch.front()}); }},
+            {"resolveLocations x64 (scratch buffers)",
+             [&]
+             {
+                 scratchIds.assign(batch.begin(), batch.end());
+                 client.resolveLocations(scratchIds, scratchResults);
+             }},
+            {"resolveLocations x64 (per-call buffers)", [&] { resolveFresh(batch); }},
+        };
+        for (const Case& benchCase : cases)
+        {
+            runCase(benchCase, numCalls);
+        }
+    }
+
+    responder.join();
+    ::close(listenFd);
+    ::unlink(socketPath.c_str());
+    ::rmdir(socketDir);
+    return EXIT_SUCCESS;
+}
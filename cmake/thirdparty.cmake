@@ -19,6 +19,9 @@ set_target_properties(
 # Python
 find_package(Python REQUIRED COMPONENTS Development)
 
+# Threads
+find_package(Threads REQUIRED)
+
 # OpenAssetIO
 find_package(OpenAssetIO CONFIG REQUIRED)
 
@@ -0,0 +1,143 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "AdmissionController.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "ScopedGilRelease.hpp"
+
+namespace
+{
+// Number of tickets held by the current thread, for re-entrancy.
+thread_local std::size_t tTicketsHeld = 0;
+
+constexpr auto kInteractiveIdx =
+    static_cast<std::size_t>(AdmissionController::Priority::kInteractive);
+
+// In-flight slots that background requests may not use.
+std::size_t interactiveReserve(const std::size_t maxInFlight)
+{
+    return maxInFlight > 1 ? std::max<std::size_t>(1, maxInFlight / 4) : 0;
+}
+}  // namespace
+
+AdmissionController::Ticket::~Ticket()
+{
+    if (_controller != nullptr)
+    {
+        _controller->release();
+    }
+}
+
+AdmissionController::Ticket::Ticket(Ticket&& other) noexcept
+    : _controller{std::exchange(other._controller, nullptr)}
+{
+}
+
+AdmissionController::Ticket& AdmissionController::Ticket::operator=(Ticket&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (_controller != nullptr)
+        {
+            _controller->release();
+        }
+        _controller = std::exchange(other._controller, nullptr);
+    }
+    return *this;
+}
+
+AdmissionController::AdmissionController(const std::size_t maxInFlight,
+                                         const double ratePerSecond,
+                                         const std::size_t burst)
+    : _maxInFlight{maxInFlight},
+      _backgroundMaxInFlight{maxInFlight - interactiveReserve(maxInFlight)},
+      _ratePerSecond{ratePerSecond},
+      _burst{std::max(1.0, static_cast<double>(burst))},
+      _tokens{_burst},
+      _lastRefill{Clock::now()}
+{
+}
+
+AdmissionController::Ticket AdmissionController::admit(const Priority priority)
+{
+    if (tTicketsHeld > 0)
+    {
+        return Ticket{};
+    }
+
+    std::unique_lock lock{_mutex};
+    if (!tryAdmitLocked(priority, Clock::now()))
+    {
+        // Requests in flight may need the GIL to complete.
+        lock.unlock();
+        const ScopedGilRelease gilRelease;
+        lock.lock();
+
+        std::size_t& waiting = _waiting[static_cast<std::size_t>(priority)];
+        ++waiting;
+        while (!tryAdmitLocked(priority, Clock::now()))
+        {
+            if (_ratePerSecond > 0 && _tokens < 1.0)
+            {
+                // Until the next token is due, unless woken sooner.
+                _cv.wait_for(lock,
+                             std::chrono::duration<double>{(1.0 - _tokens) / _ratePerSecond});
+            }
+            else
+            {
+                _cv.wait(lock);
+            }
+        }
+        --waiting;
+        // Before the GIL is reacquired.
+        lock.unlock();
+        // Background requests may have been held back for this one.
+        _cv.notify_all();
+    }
+    ++tTicketsHeld;
+    return Ticket{this};
+}
+
+bool AdmissionController::tryAdmitLocked(const Priority priority, const Clock::time_point now)
+{
+    if (_ratePerSecond > 0)
+    {
+        const double elapsed = std::chrono::duration<double>{now - _lastRefill}.count();
+        _tokens = std::min(_burst, _tokens + elapsed * _ratePerSecond);
+        _lastRefill = now;
+    }
+
+    if (priority == Priority::kBackground && _waiting[kInteractiveIdx] > 0)
+    {
+        return false;
+    }
+    const std::size_t limit =
+        priority == Priority::kInteractive ? _maxInFlight : _backgroundMaxInFlight;
+    if (_maxInFlight != 0 && _inFlight >= limit)
+    {
+        return false;
+    }
+    if (_ratePerSecond > 0)
+    {
+        if (_tokens < 1.0)
+        {
+            return false;
+        }
+        _tokens -= 1.0;
+    }
+    ++_inFlight;
+    return true;
+}
+
+void AdmissionController::release()
+{
+    {
+        const std::lock_guard lock{_mutex};
+        --_inFlight;
+    }
+    --tTicketsHeld;
+    _cv.notify_all();
+}
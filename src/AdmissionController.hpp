@@ -0,0 +1,92 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * Bounds the load a process places on the asset management system, by
+ * limiting the number of manager requests in flight and the rate at
+ * which they start, whilst letting interactive requests jump the queue.
+ *
+ * Requests in the interactive lane are admitted before any waiting
+ * background request, and a quarter of the in-flight slots are reserved
+ * for them, so that background work cannot delay an interactive
+ * request by more than one request's duration.
+ *
+ * Admission is re-entrant: a thread already holding a ticket is
+ * admitted immediately, so that nested manager calls cannot deadlock.
+ */
+class AdmissionController
+{
+public:
+    enum class Priority : std::uint8_t
+    {
+        /// User-facing and cook-critical requests.
+        kInteractive,
+        /// Requests nobody is directly waiting on.
+        kBackground,
+    };
+
+    /**
+     * Permission to make a manager request, relinquished on
+     * destruction. An empty ticket (e.g. default constructed) does
+     * nothing.
+     */
+    class Ticket
+    {
+    public:
+        Ticket() = default;
+        ~Ticket();
+        Ticket(Ticket&& other) noexcept;
+        Ticket& operator=(Ticket&& other) noexcept;
+        Ticket(const Ticket&) = delete;
+        Ticket& operator=(const Ticket&) = delete;
+
+    private:
+        friend class AdmissionController;
+        explicit Ticket(AdmissionController* controller) : _controller{controller} {}
+
+        AdmissionController* _controller{nullptr};
+    };
+
+    /**
+     * @param maxInFlight Maximum concurrent requests, or 0 for no
+     * limit.
+     * @param ratePerSecond Sustained request start rate, or 0 for no
+     * limit.
+     * @param burst Number of requests that may start at once after a
+     * period of inactivity, if rate limited.
+     */
+    AdmissionController(std::size_t maxInFlight, double ratePerSecond, std::size_t burst);
+
+    /**
+     * Block until a request may be made. Releases the Python GIL, if
+     * held, whilst waiting.
+     */
+    [[nodiscard]] Ticket admit(Priority priority);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    [[nodiscard]] bool tryAdmitLocked(Priority priority, Clock::time_point now);
+    void release();
+
+    const std::size_t _maxInFlight;
+    const std::size_t _backgroundMaxInFlight;
+    const double _ratePerSecond;
+    const double _burst;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::size_t _inFlight{0};
+    std::array<std::size_t, 2> _waiting{};
+    double _tokens;
+    Clock::time_point _lastRefill;
+};
@@ -0,0 +1,94 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "AssetTable.hpp"
+
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+std::optional<AssetTable::Column> AssetTable::ParseColumn(const std::string_view name)
+{
+    if (name == "name")
+    {
+        return Column::kName;
+    }
+    if (name == "version")
+    {
+        return Column::kVersion;
+    }
+    if (name == "resolvedVersion")
+    {
+        return Column::kResolvedVersion;
+    }
+    if (name == "location")
+    {
+        return Column::kLocation;
+    }
+    if (name == "scenegraphLocation")
+    {
+        return Column::kScenegraphLocation;
+    }
+    return std::nullopt;
+}
+
+AssetTable::AssetTable(const std::size_t rowCount, std::vector<Column> columns)
+    : _rowCount{rowCount},
+      _columns{std::move(columns)},
+      _cells(rowCount * _columns.size(), Cell{0, 0}),
+      _failed(rowCount, false)
+{
+}
+
+std::size_t AssetTable::rowCount() const
+{
+    return _rowCount;
+}
+
+const std::vector<AssetTable::Column>& AssetTable::columns() const
+{
+    return _columns;
+}
+
+std::string_view AssetTable::get(const std::size_t row, const std::size_t columnIdx) const
+{
+    const Cell& cell = _cells[cellIndex(row, columnIdx)];
+    return std::string_view{_values}.substr(cell.offset, cell.length);
+}
+
+void AssetTable::set(const std::size_t row,
+                     const std::size_t columnIdx,
+                     const std::string_view value)
+{
+    if (_values.size() + value.size() > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::length_error{"Asset table too large"};
+    }
+    _cells[cellIndex(row, columnIdx)] = Cell{static_cast<std::uint32_t>(_values.size()),
+                                             static_cast<std::uint32_t>(value.size())};
+    _values += value;
+}
+
+bool AssetTable::failed(const std::size_t row) const
+{
+    return _failed[row];
+}
+
+void AssetTable::setFailed(const std::size_t row)
+{
+    _failed[row] = true;
+    for (std::size_t columnIdx = 0; columnIdx < _columns.size(); ++columnIdx)
+    {
+        _cells[cellIndex(row, columnIdx)] = Cell{0, 0};
+    }
+}
+
+void AssetTable::reserve(const std::size_t valueBytes)
+{
+    _values.reserve(valueBytes);
+}
+
+std::size_t AssetTable::cellIndex(const std::size_t row, const std::size_t columnIdx) const
+{
+    return columnIdx * _rowCount + row;
+}
@@ -0,0 +1,93 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Column-oriented metadata of a list of assets, e.g. to fill a table in
+ * a UI, as returned by `OpenAssetIOAsset::getAssetTable`.
+ *
+ * Values are appended to a single buffer, and each cell refers to its
+ * value by offset, so a table of any size is two allocations rather
+ * than one per cell. Cells are stored column by column, so each column
+ * is contiguous.
+ */
+class AssetTable
+{
+public:
+    /// Metadata that may be requested, each equivalent to an AssetAPI
+    /// entry point.
+    enum class Column : std::uint8_t
+    {
+        /// As the "name" field of getAssetFields, or
+        /// getAssetDisplayName.
+        kName,
+        /// As the "version" field of getAssetFields.
+        kVersion,
+        /// As resolveAssetVersion, with no alternate version.
+        kResolvedVersion,
+        /// As resolveAsset.
+        kLocation,
+        /// As getUniqueScenegraphLocationFromAssetId, without the
+        /// version.
+        kScenegraphLocation,
+    };
+
+    /**
+     * @return The column with the given name, being the enumerator
+     * without its "k" prefix, in camel case, e.g. "resolvedVersion".
+     */
+    static std::optional<Column> ParseColumn(std::string_view name);
+
+    AssetTable() = default;
+    AssetTable(std::size_t rowCount, std::vector<Column> columns);
+
+    [[nodiscard]] std::size_t rowCount() const;
+    [[nodiscard]] const std::vector<Column>& columns() const;
+
+    /**
+     * @return The value of a cell, or an empty string if it has not
+     * been set. Invalidated by `set`.
+     */
+    [[nodiscard]] std::string_view get(std::size_t row, std::size_t columnIdx) const;
+
+    /**
+     * Set the value of a cell, which must not already be set.
+     */
+    void set(std::size_t row, std::size_t columnIdx, std::string_view value);
+
+    /**
+     * @return Whether the row's asset could not be queried, in which
+     * case its cells are empty.
+     */
+    [[nodiscard]] bool failed(std::size_t row) const;
+
+    void setFailed(std::size_t row);
+
+    /**
+     * Reserve space for values, to avoid reallocating as they are set.
+     */
+    void reserve(std::size_t valueBytes);
+
+private:
+    struct Cell
+    {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    [[nodiscard]] std::size_t cellIndex(std::size_t row, std::size_t columnIdx) const;
+
+    std::size_t _rowCount{0};
+    std::vector<Column> _columns;
+    std::vector<Cell> _cells;
+    std::vector<bool> _failed;
+    std::string _values;
+};
@@ -0,0 +1,399 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "AsyncQueries.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <openassetio_mediacreation/openassetio_mediacreation.hpp>
+
+#include "Constants.hpp"
+#include "Environment.hpp"
+#include "ManagerLoader.hpp"
+
+namespace
+{
+using openassetio::trait::TraitSet;
+using openassetio_mediacreation::traits::content::LocatableContentTrait;
+using openassetio_mediacreation::traits::identity::DisplayNameTrait;
+using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+
+// Largest number of assets in a single manager call. Smaller batches
+// are split between the workers.
+constexpr std::size_t kMaxChunkSize{256};
+
+const TraitSet& LocationTraits()
+{
+    static const TraitSet kTraits{LocatableContentTrait::kId};
+    return kTraits;
+}
+
+const TraitSet& FieldTraits()
+{
+    static const TraitSet kTraits{DisplayNameTrait::kId, VersionTrait::kId};
+    return kTraits;
+}
+
+const TraitSet& VersionTraits()
+{
+    static const TraitSet kTraits{VersionTrait::kId};
+    return kTraits;
+}
+
+const openassetio::trait::TraitsDataPtr& AllVersionsRelationship()
+{
+    using openassetio_mediacreation::specifications::lifecycle::
+        EntityVersionsRelationshipSpecification;
+    static const openassetio::trait::TraitsDataPtr kRelationship =
+        EntityVersionsRelationshipSpecification::create().traitsData();
+    return kRelationship;
+}
+
+// Version lists are cached as newline-terminated tags, as by the plugin.
+void encodeVersions(const std::vector<std::string>& versions, std::string& out)
+{
+    out.clear();
+    for (const std::string& version : versions)
+    {
+        out += version;
+        out += '\n';
+    }
+}
+
+void decodeVersions(std::string_view encoded, std::vector<std::string>& out)
+{
+    while (!encoded.empty())
+    {
+        const auto end = encoded.find('\n');
+        out.emplace_back(encoded.substr(0, end));
+        encoded.remove_prefix(end == std::string_view::npos ? encoded.size() : end + 1);
+    }
+}
+}  // namespace
+
+struct AsyncQueries::Batch
+{
+    std::vector<std::string> assetIds;
+    Results results;
+    Completion completion;
+    std::atomic<std::size_t> chunksRemaining{0};
+};
+
+AsyncQueries::AsyncQueries(openassetio::hostApi::ManagerPtr manager,
+                           const openassetio::log::LoggerInterfacePtr& logger,
+                           const std::size_t numThreads)
+    : _manager{std::move(manager)},
+      _context{ManagerLoader::CreateContext(_manager, logger)},
+      _pool{numThreads}
+{
+    const std::size_t budgetMegabytes = Environment::GetUnsigned(Constants::kCacheBudgetEnvVar, 0);
+    _entityCache.setBudget(budgetMegabytes * 1024 * 1024);
+}
+
+AsyncQueries::~AsyncQueries()
+{
+    wait();
+}
+
+void AsyncQueries::submit(const Query query,
+                          std::vector<std::string> assetIds,
+                          Completion completion)
+{
+    auto batch = std::make_shared<Batch>();
+    batch->results.resize(assetIds.size());
+    batch->assetIds = std::move(assetIds);
+    batch->completion = std::move(completion);
+
+    // Spread the batch over the workers, within the limit on the size
+    // of a single manager call. An empty batch is a single, empty,
+    // chunk, so that its completion is still called.
+    const std::size_t numAssets = batch->assetIds.size();
+    const std::size_t chunkSize =
+        std::clamp<std::size_t>((numAssets + _pool.size() - 1) / _pool.size(), 1, kMaxChunkSize);
+    const std::size_t numChunks = std::max<std::size_t>((numAssets + chunkSize - 1) / chunkSize, 1);
+    batch->chunksRemaining.store(numChunks, std::memory_order_relaxed);
+
+    {
+        const std::lock_guard lock{_pendingMutex};
+        ++_pendingBatches;
+    }
+    for (std::size_t begin = 0, chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx, begin += chunkSize)
+    {
+        const std::size_t end = std::min(begin + chunkSize, numAssets);
+        _pool.post(
+            [this, query, batch, begin, end]
+            {
+                runChunk(query, *batch, begin, end);
+                if (batch->chunksRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    finishBatch(*batch);
+                }
+            });
+    }
+}
+
+void AsyncQueries::wait()
+{
+    std::unique_lock lock{_pendingMutex};
+    _pendingCv.wait(lock, [this] { return _pendingBatches == 0; });
+}
+
+void AsyncQueries::flushCaches()
+{
+    _entityCache.clear();
+    _fileUrlPathConverter.clear();
+    _manager->flushCaches();
+}
+
+void AsyncQueries::runChunk(const Query query,
+                            Batch& batch,
+                            const std::size_t begin,
+                            const std::size_t end)
+{
+    // Results of queries started before a flush must not be cached.
+    const EntityCache::Generation generation = _entityCache.generation();
+    try
+    {
+        // Serve what we can from the cache, and query the rest
+        // together. Indices into the batch of the assets queried.
+        openassetio::EntityReferences entityRefs;
+        std::vector<std::size_t> resultIdxs;
+        for (std::size_t idx = begin; idx < end; ++idx)
+        {
+            const std::string& assetId = batch.assetIds[idx];
+            Result& result = batch.results[idx];
+            if (getCached(query, assetId, result.values))
+            {
+                result.succeeded = true;
+                continue;
+            }
+            auto entityRef = _manager->createEntityReferenceIfValid(assetId);
+            if (!entityRef)
+            {
+                result.values.clear();
+                result.error = assetId + " is not a valid entity reference";
+                continue;
+            }
+            entityRefs.push_back(std::move(*entityRef));
+            resultIdxs.push_back(idx);
+        }
+        if (entityRefs.empty())
+        {
+            return;
+        }
+
+        if (query == Query::kVersions)
+        {
+            resolveVersions(batch, entityRefs, resultIdxs, generation);
+        }
+        else
+        {
+            resolveTraits(query, batch, entityRefs, resultIdxs, generation);
+        }
+    }
+    catch (const std::exception& exc)
+    {
+        for (std::size_t idx = begin; idx < end; ++idx)
+        {
+            Result& result = batch.results[idx];
+            if (!result.succeeded && result.error.empty())
+            {
+                result.values.clear();
+                result.error = exc.what();
+            }
+        }
+    }
+}
+
+bool AsyncQueries::getCached(const Query query,
+                             const std::string& assetId,
+                             std::vector<std::string>& values) const
+{
+    using Field = EntityCache::Field;
+
+    switch (query)
+    {
+    case Query::kResolve:
+        values.resize(1);
+        return _entityCache.get(assetId, Field::kLocation, values[0]);
+    case Query::kFields:
+        values.resize(2);
+        return _entityCache.get(assetId, Field::kDisplayName, values[0]) &&
+               _entityCache.get(assetId, Field::kVersionTag, values[1]);
+    case Query::kVersions:
+    {
+        std::string encoded;
+        if (!_entityCache.get(assetId, Field::kVersions, encoded))
+        {
+            return false;
+        }
+        decodeVersions(encoded, values);
+        return true;
+    }
+    }
+    return false;
+}
+
+void AsyncQueries::resolveTraits(const Query query,
+                                 Batch& batch,
+                                 const openassetio::EntityReferences& entityRefs,
+                                 const std::vector<std::size_t>& resultIdxs,
+                                 const EntityCache::Generation generation)
+{
+    using openassetio::access::ResolveAccess;
+    using openassetio::errors::BatchElementError;
+    using Field = EntityCache::Field;
+
+    _manager->resolve(
+        entityRefs,
+        query == Query::kResolve ? LocationTraits() : FieldTraits(),
+        ResolveAccess::kRead,
+        _context,
+        [&](const std::size_t idx, const openassetio::trait::TraitsDataPtr& traitsData)
+        {
+            const std::string& assetId = batch.assetIds[resultIdxs[idx]];
+            Result& result = batch.results[resultIdxs[idx]];
+            if (query == Query::kFields)
+            {
+                result.values = {DisplayNameTrait{traitsData}.getName(""),
+                                 VersionTrait{traitsData}.getSpecifiedTag("")};
+                _entityCache.put(assetId, Field::kDisplayName, result.values[0], generation);
+                _entityCache.put(assetId, Field::kVersionTag, result.values[1], generation);
+                result.succeeded = true;
+                return;
+            }
+
+            const auto url = LocatableContentTrait(traitsData).getLocation();
+            if (!url)
+            {
+                result.error = assetId + " has no location";
+                return;
+            }
+            try
+            {
+                result.values.resize(1);
+                _fileUrlPathConverter.pathFromUrl(*url, result.values[0]);
+                _entityCache.put(assetId, Field::kLocation, result.values[0], generation);
+                result.succeeded = true;
+            }
+            catch (const std::exception& exc)
+            {
+                result.values.clear();
+                result.error = exc.what();
+            }
+        },
+        [&](const std::size_t idx, const BatchElementError& error)
+        { batch.results[resultIdxs[idx]].error = error.message; });
+}
+
+void AsyncQueries::resolveVersions(Batch& batch,
+                                   const openassetio::EntityReferences& entityRefs,
+                                   const std::vector<std::size_t>& resultIdxs,
+                                   const EntityCache::Generation generation)
+{
+    using openassetio::EntityReferences;
+    using openassetio::access::RelationsAccess;
+    using openassetio::access::ResolveAccess;
+    using openassetio::errors::BatchElementError;
+    using openassetio::hostApi::EntityReferencePagerPtr;
+
+    const auto fail = [&batch](const std::size_t idx, const BatchElementError& error)
+    {
+        Result& result = batch.results[idx];
+        if (result.error.empty())
+        {
+            result.error = error.message;
+        }
+    };
+
+    // A single relationship query for the versions of every asset.
+    std::vector<EntityReferencePagerPtr> pagers(entityRefs.size());
+    _manager->getWithRelationship(
+        entityRefs,
+        AllVersionsRelationship(),
+        Constants::kPageSize,
+        RelationsAccess::kRead,
+        _context,
+        [&pagers](const std::size_t queryIdx, EntityReferencePagerPtr pager)
+        { pagers[queryIdx] = std::move(pager); },
+        [&](const std::size_t queryIdx, const BatchElementError& error)
+        { fail(resultIdxs[queryIdx], error); });
+
+    // Gather every version of every asset, noting where each result
+    // belongs, as (index into the batch, index within that asset's
+    // versions).
+    EntityReferences versionRefs;
+    std::vector<std::pair<std::size_t, std::size_t>> versionSlots;
+    for (std::size_t queryIdx = 0; queryIdx < pagers.size(); ++queryIdx)
+    {
+        if (!pagers[queryIdx])
+        {
+            continue;
+        }
+        std::vector<std::string>& versions = batch.results[resultIdxs[queryIdx]].values;
+        for (EntityReferences page; !(page = pagers[queryIdx]->get()).empty();
+             pagers[queryIdx]->next())
+        {
+            for (auto& versionRef : page)
+            {
+                versionSlots.emplace_back(resultIdxs[queryIdx], versions.size());
+                versions.emplace_back();
+                versionRefs.push_back(std::move(versionRef));
+            }
+        }
+    }
+
+    // A single resolve for the tags of all versions of all assets.
+    if (!versionRefs.empty())
+    {
+        _manager->resolve(
+            versionRefs,
+            VersionTraits(),
+            ResolveAccess::kRead,
+            _context,
+            [&](const std::size_t versionIdx, const openassetio::trait::TraitsDataPtr& traitsData)
+            {
+                const auto& [idx, slotIdx] = versionSlots[versionIdx];
+                batch.results[idx].values[slotIdx] = VersionTrait{traitsData}.getSpecifiedTag("");
+            },
+            [&](const std::size_t versionIdx, const BatchElementError& error)
+            { fail(versionSlots[versionIdx].first, error); });
+    }
+
+    std::string encoded;
+    for (const std::size_t idx : resultIdxs)
+    {
+        Result& result = batch.results[idx];
+        if (!result.error.empty())
+        {
+            result.values.clear();
+            continue;
+        }
+        result.succeeded = true;
+        encodeVersions(result.values, encoded);
+        _entityCache.put(batch.assetIds[idx], EntityCache::Field::kVersions, encoded, generation);
+    }
+}
+
+void AsyncQueries::finishBatch(Batch& batch)
+{
+    batch.completion(std::move(batch.results));
+    // Before signalling, in case whatever it captured must not outlive
+    // us.
+    batch.completion = nullptr;
+
+    const std::lock_guard lock{_pendingMutex};
+    --_pendingBatches;
+    // Whilst locked, since a waiter may then destroy us.
+    _pendingCv.notify_all();
+}
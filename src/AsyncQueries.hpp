@@ -0,0 +1,127 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+
+#include "EntityCache.hpp"
+#include "FileUrlPathConverter.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * Runs batches of asset queries on a pool of worker threads, reporting
+ * the results of each batch to a completion callback, such that callers
+ * (e.g. UI event loops) need not block on the manager.
+ *
+ * Large batches are split into chunks that are queried concurrently,
+ * each chunk being a single batched manager call. Results are cached
+ * until `flushCaches` is called.
+ */
+class AsyncQueries
+{
+public:
+    enum class Query : std::uint8_t
+    {
+        /// The file system path of each asset.
+        kResolve,
+        /// The display name and version tag of each asset.
+        kFields,
+        /// The version tags of every version of each asset.
+        kVersions,
+    };
+
+    struct Result
+    {
+        bool succeeded{false};
+        /// Path, {display name, version tag}, or version tags, for
+        /// each Query respectively.
+        std::vector<std::string> values;
+        /// Reason for failure, if not succeeded.
+        std::string error;
+    };
+    using Results = std::vector<Result>;
+    /// Receives the results of a batch, in the order of its asset IDs.
+    /// Called on a worker thread, and must not throw.
+    using Completion = std::function<void(Results)>;
+
+    /**
+     * @param manager Manager to query.
+     * @param logger Receives warnings, e.g. if the session given by
+     * KATANAOPENASSETIO_CONTEXT_TOKEN can't be restored.
+     * @param numThreads Number of worker threads.
+     */
+    AsyncQueries(openassetio::hostApi::ManagerPtr manager,
+                 const openassetio::log::LoggerInterfacePtr& logger,
+                 std::size_t numThreads);
+
+    /**
+     * Waits for all submitted batches to complete.
+     */
+    ~AsyncQueries();
+
+    AsyncQueries(const AsyncQueries&) = delete;
+    AsyncQueries& operator=(const AsyncQueries&) = delete;
+
+    /**
+     * Queue a batch of queries. The completion is called exactly once,
+     * including if the batch is empty.
+     */
+    void submit(Query query, std::vector<std::string> assetIds, Completion completion);
+
+    /**
+     * Block until all submitted batches have completed.
+     */
+    void wait();
+
+    /**
+     * Discard cached results, and ask the manager to do the same.
+     */
+    void flushCaches();
+
+    /**
+     * @return Whether the calling thread is one of our workers, e.g.
+     * within a completion, where destruction would deadlock.
+     */
+    [[nodiscard]] bool isWorkerThread() const { return _pool.isWorkerThread(); }
+
+private:
+    struct Batch;
+
+    void runChunk(Query query, Batch& batch, std::size_t begin, std::size_t end);
+    bool getCached(Query query, const std::string& assetId, std::vector<std::string>& values) const;
+    void resolveTraits(Query query,
+                       Batch& batch,
+                       const openassetio::EntityReferences& entityRefs,
+                       const std::vector<std::size_t>& resultIdxs,
+                       EntityCache::Generation generation);
+    void resolveVersions(Batch& batch,
+                         const openassetio::EntityReferences& entityRefs,
+                         const std::vector<std::size_t>& resultIdxs,
+                         EntityCache::Generation generation);
+    void finishBatch(Batch& batch);
+
+    const openassetio::hostApi::ManagerPtr _manager;
+    const openassetio::ContextPtr _context;
+    EntityCache _entityCache;
+    CachingFileUrlPathConverter _fileUrlPathConverter;
+
+    std::mutex _pendingMutex;
+    std::condition_variable _pendingCv;
+    std::size_t _pendingBatches{0};
+
+    // Last, so that workers are stopped before anything they use is
+    // destroyed.
+    ThreadPool _pool;
+};
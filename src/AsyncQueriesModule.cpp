@@ -0,0 +1,520 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+
+// Python extension module exposing AsyncQueries, such that Katana
+// scripts and UIs can query assets without blocking on the manager.
+#include <Python.h>
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/log/ConsoleLogger.hpp>
+#include <openassetio/log/SeverityFilter.hpp>
+#include <openassetio/python/converter.hpp>
+
+#include "AsyncQueries.hpp"
+#include "Constants.hpp"
+#include "KatanaHostInterface.hpp"
+#include "ManagerLoader.hpp"
+#include "PythonBridge.hpp"
+#include "ScopedGilRelease.hpp"
+
+namespace
+{
+using Query = AsyncQueries::Query;
+
+// Katana's AssetAPI names for the fields we query.
+constexpr const char* kNameField = "name";
+constexpr const char* kVersionField = "version";
+
+// concurrent.futures.Future, imported on module initialisation.
+PyObject* gFutureType = nullptr;
+
+// Owned reference to a Python object.
+struct PyObjectRef
+{
+    explicit PyObjectRef(PyObject* object) : ptr{object} {}
+    ~PyObjectRef() { Py_XDECREF(ptr); }
+    PyObjectRef(const PyObjectRef&) = delete;
+    PyObjectRef& operator=(const PyObjectRef&) = delete;
+
+    PyObject* release() { return std::exchange(ptr, nullptr); }
+
+    PyObject* ptr;
+};
+
+struct PyAsyncQueries
+{
+    PyObject_HEAD
+    AsyncQueries* queries;
+};
+
+// Paths may not be valid UTF-8, so are decoded as Python does file
+// system paths.
+PyObject* toPyStr(const std::string& str)
+{
+    return PyUnicode_DecodeUTF8(
+        str.data(), static_cast<Py_ssize_t>(str.size()), "surrogateescape");
+}
+
+PyObject* toPyList(const std::vector<std::string>& strs)
+{
+    PyObjectRef list{PyList_New(static_cast<Py_ssize_t>(strs.size()))};
+    if (list.ptr == nullptr)
+    {
+        return nullptr;
+    }
+    for (std::size_t idx = 0; idx < strs.size(); ++idx)
+    {
+        PyObject* str = toPyStr(strs[idx]);
+        if (str == nullptr)
+        {
+            return nullptr;
+        }
+        PyList_SET_ITEM(list.ptr, static_cast<Py_ssize_t>(idx), str);
+    }
+    return list.release();
+}
+
+// Convert a query's result to its Python equivalent, or an exception
+// instance if it failed.
+PyObject* toPyResult(const Query query, const AsyncQueries::Result& result)
+{
+    if (!result.succeeded)
+    {
+        return PyObject_CallFunction(PyExc_RuntimeError, "s", result.error.c_str());
+    }
+    switch (query)
+    {
+    case Query::kResolve:
+        return toPyStr(result.values.front());
+    case Query::kFields:
+    {
+        const PyObjectRef name{toPyStr(result.values[0])};
+        const PyObjectRef version{toPyStr(result.values[1])};
+        if (name.ptr == nullptr || version.ptr == nullptr)
+        {
+            return nullptr;
+        }
+        return Py_BuildValue("{s:O,s:O}", kNameField, name.ptr, kVersionField, version.ptr);
+    }
+    case Query::kVersions:
+        return toPyList(result.values);
+    }
+    Py_RETURN_NONE;
+}
+
+// Deliver results to a future, taking ownership of the reference to
+// it. Runs on a worker thread.
+AsyncQueries::Completion makeCompletion(const Query query, PyObject* future)
+{
+    return [query, future](const AsyncQueries::Results results)
+    {
+        const PyGILState_STATE gilState = PyGILState_Ensure();
+        {
+            const PyObjectRef futureRef{future};
+            PyObjectRef list{PyList_New(static_cast<Py_ssize_t>(results.size()))};
+            for (std::size_t idx = 0; list.ptr != nullptr && idx < results.size(); ++idx)
+            {
+                PyObject* value = toPyResult(query, results[idx]);
+                if (value == nullptr)
+                {
+                    Py_CLEAR(list.ptr);
+                    break;
+                }
+                PyList_SET_ITEM(list.ptr, static_cast<Py_ssize_t>(idx), value);
+            }
+
+            PyObjectRef ret{nullptr};
+            if (list.ptr != nullptr)
+            {
+                // Also runs any done callbacks.
+                ret.ptr = PyObject_CallMethod(future, "set_result", "O", list.ptr);
+            }
+            else
+            {
+                PyObject* type = nullptr;
+                PyObject* value = nullptr;
+                PyObject* traceback = nullptr;
+                PyErr_Fetch(&type, &value, &traceback);
+                PyErr_NormalizeException(&type, &value, &traceback);
+                const PyObjectRef typeRef{type};
+                const PyObjectRef valueRef{value};
+                const PyObjectRef tracebackRef{traceback};
+                ret.ptr = PyObject_CallMethod(
+                    future, "set_exception", "O", value != nullptr ? value : Py_None);
+            }
+            if (ret.ptr == nullptr)
+            {
+                PyObject* type = nullptr;
+                PyObject* value = nullptr;
+                PyObject* traceback = nullptr;
+                PyErr_Fetch(&type, &value, &traceback);
+                // If the future was cancelled, the result is no longer
+                // wanted.
+                const PyObjectRef cancelled{PyObject_CallMethod(future, "cancelled", nullptr)};
+                PyErr_Clear();
+                if (cancelled.ptr == Py_True)
+                {
+                    Py_XDECREF(type);
+                    Py_XDECREF(value);
+                    Py_XDECREF(traceback);
+                }
+                else
+                {
+                    PyErr_Restore(type, value, traceback);
+                    PyErr_WriteUnraisable(future);
+                }
+            }
+        }
+        PyGILState_Release(gilState);
+    };
+}
+
+openassetio::log::LoggerInterfacePtr makeLogger()
+{
+    using openassetio::log::ConsoleLogger;
+    using openassetio::log::SeverityFilter;
+    // Honours OPENASSETIO_LOGGING_SEVERITY.
+    return SeverityFilter::make(ConsoleLogger::make());
+}
+
+// Must be called with the GIL held.
+void destroyQueries(AsyncQueries* queries)
+{
+    if (queries->isWorkerThread())
+    {
+        // Released by a completion (e.g. a done callback), which
+        // cannot wait for itself.
+        std::thread{[queries]
+                    {
+                        queries->wait();
+                        const PyGILState_STATE gilState = PyGILState_Ensure();
+                        delete queries;
+                        PyGILState_Release(gilState);
+                    }}
+            .detach();
+        return;
+    }
+    {
+        // Completions need the GIL.
+        const ScopedGilRelease gilRelease;
+        queries->wait();
+    }
+    // With the GIL held, since the manager may be implemented in
+    // Python.
+    delete queries;
+}
+
+int AsyncQueries_init(PyAsyncQueries* self, PyObject* args, PyObject* kwargs)
+{
+    static const char* kKeywords[] = {"manager", "threads", nullptr};
+    PyObject* pyManager = Py_None;
+    Py_ssize_t numThreads = static_cast<Py_ssize_t>(Constants::kDefaultAsyncQueryThreads);
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwargs,
+                                     "|On:AsyncQueries",
+                                     const_cast<char**>(kKeywords),
+                                     &pyManager,
+                                     &numThreads))
+    {
+        return -1;
+    }
+    if (numThreads < 1)
+    {
+        PyErr_SetString(PyExc_ValueError, "threads must be at least 1");
+        return -1;
+    }
+
+    try
+    {
+        const openassetio::log::LoggerInterfacePtr logger = makeLogger();
+        openassetio::hostApi::ManagerPtr manager;
+        if (pyManager == Py_None)
+        {
+            manager =
+                ManagerLoader::LoadDefaultManager(std::make_shared<KatanaHostInterface>(), logger);
+        }
+        else
+        {
+            manager = openassetio::python::converter::castFromPyObject<
+                openassetio::hostApi::Manager>(pyManager);
+        }
+        auto queries = std::make_unique<AsyncQueries>(
+            std::move(manager), logger, static_cast<std::size_t>(numThreads));
+        if (self->queries != nullptr)
+        {
+            destroyQueries(self->queries);
+        }
+        self->queries = queries.release();
+    }
+    catch (const std::exception& exc)
+    {
+        PyErr_SetString(PyExc_RuntimeError, exc.what());
+        return -1;
+    }
+    return 0;
+}
+
+void AsyncQueries_dealloc(PyAsyncQueries* self)
+{
+    PyTypeObject* type = Py_TYPE(self);
+    if (self->queries != nullptr)
+    {
+        destroyQueries(self->queries);
+    }
+    type->tp_free(self);
+    Py_DECREF(type);
+}
+
+PyObject* submit(PyAsyncQueries* self, const Query query, PyObject* args, PyObject* kwargs)
+{
+    static const char* kKeywords[] = {"assetIds", "callback", nullptr};
+    PyObject* pyAssetIds = nullptr;
+    PyObject* callback = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwargs, "O|O", const_cast<char**>(kKeywords), &pyAssetIds, &callback))
+    {
+        return nullptr;
+    }
+    if (self->queries == nullptr)
+    {
+        PyErr_SetString(PyExc_RuntimeError, "AsyncQueries is not initialised");
+        return nullptr;
+    }
+    if (PyUnicode_Check(pyAssetIds))
+    {
+        PyErr_SetString(PyExc_TypeError, "assetIds must be a sequence of str, not a str");
+        return nullptr;
+    }
+
+    const PyObjectRef sequence{PySequence_Fast(pyAssetIds, "assetIds must be a sequence of str")};
+    if (sequence.ptr == nullptr)
+    {
+        return nullptr;
+    }
+    const Py_ssize_t numAssets = PySequence_Fast_GET_SIZE(sequence.ptr);
+    std::vector<std::string> assetIds;
+    assetIds.reserve(static_cast<std::size_t>(numAssets));
+    for (Py_ssize_t idx = 0; idx < numAssets; ++idx)
+    {
+        Py_ssize_t size = 0;
+        const char* utf8 =
+            PyUnicode_AsUTF8AndSize(PySequence_Fast_GET_ITEM(sequence.ptr, idx), &size);
+        if (utf8 == nullptr)
+        {
+            return nullptr;
+        }
+        assetIds.emplace_back(utf8, static_cast<std::size_t>(size));
+    }
+
+    PyObjectRef future{PyObject_CallObject(gFutureType, nullptr)};
+    if (future.ptr == nullptr)
+    {
+        return nullptr;
+    }
+    if (callback != Py_None)
+    {
+        const PyObjectRef ret{
+            PyObject_CallMethod(future.ptr, "add_done_callback", "O", callback)};
+        if (ret.ptr == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    try
+    {
+        // The completion's reference.
+        Py_INCREF(future.ptr);
+        auto completion = makeCompletion(query, future.ptr);
+        self->queries->submit(query, std::move(assetIds), std::move(completion));
+    }
+    catch (const std::exception& exc)
+    {
+        Py_DECREF(future.ptr);
+        PyErr_SetString(PyExc_RuntimeError, exc.what());
+        return nullptr;
+    }
+    return future.release();
+}
+
+PyObject* AsyncQueries_resolve(PyAsyncQueries* self, PyObject* args, PyObject* kwargs)
+{
+    return submit(self, Query::kResolve, args, kwargs);
+}
+
+PyObject* AsyncQueries_fields(PyAsyncQueries* self, PyObject* args, PyObject* kwargs)
+{
+    return submit(self, Query::kFields, args, kwargs);
+}
+
+PyObject* AsyncQueries_versions(PyAsyncQueries* self, PyObject* args, PyObject* kwargs)
+{
+    return submit(self, Query::kVersions, args, kwargs);
+}
+
+PyObject* AsyncQueries_wait(PyAsyncQueries* self, PyObject* /*args*/)
+{
+    if (self->queries == nullptr)
+    {
+        Py_RETURN_NONE;
+    }
+    if (self->queries->isWorkerThread())
+    {
+        PyErr_SetString(PyExc_RuntimeError, "Cannot wait for queries from within a callback");
+        return nullptr;
+    }
+    {
+        const ScopedGilRelease gilRelease;
+        self->queries->wait();
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject* AsyncQueries_flushCaches(PyAsyncQueries* self, PyObject* /*args*/)
+{
+    if (self->queries == nullptr)
+    {
+        Py_RETURN_NONE;
+    }
+    try
+    {
+        self->queries->flushCaches();
+    }
+    catch (const std::exception& exc)
+    {
+        PyErr_SetString(PyExc_RuntimeError, exc.what());
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+// Cast via void(*)(), the documented way to store keyword-accepting
+// functions in a PyMethodDef.
+template <typename Fn>
+PyCFunction asPyCFunction(Fn* function)
+{
+    return reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(function));
+}
+
+PyMethodDef kAsyncQueriesMethods[] = {
+    {"resolve",
+     asPyCFunction(&AsyncQueries_resolve),
+     METH_VARARGS | METH_KEYWORDS,
+     "resolve(assetIds, callback=None) -> concurrent.futures.Future\n\n"
+     "Resolve the file system path of each asset. The future's result is a\n"
+     "list with, per asset, its path, or an exception if it failed."},
+    {"fields",
+     asPyCFunction(&AsyncQueries_fields),
+     METH_VARARGS | METH_KEYWORDS,
+     "fields(assetIds, callback=None) -> concurrent.futures.Future\n\n"
+     "Query the 'name' and 'version' fields of each asset. The future's\n"
+     "result is a list with, per asset, a dict of its fields, or an\n"
+     "exception if it failed."},
+    {"versions",
+     asPyCFunction(&AsyncQueries_versions),
+     METH_VARARGS | METH_KEYWORDS,
+     "versions(assetIds, callback=None) -> concurrent.futures.Future\n\n"
+     "List the version tags of each asset. The future's result is a list\n"
+     "with, per asset, a list of its versions, or an exception if it failed."},
+    {"wait",
+     asPyCFunction(&AsyncQueries_wait),
+     METH_NOARGS,
+     "wait()\n\nBlock until all submitted queries have completed."},
+    {"flushCaches",
+     asPyCFunction(&AsyncQueries_flushCaches),
+     METH_NOARGS,
+     "flushCaches()\n\nDiscard cached results, e.g. when Katana flushes its caches."},
+    {nullptr, nullptr, 0, nullptr},
+};
+
+PyType_Slot kAsyncQueriesSlots[] = {
+    {Py_tp_doc,
+     const_cast<char*>(
+         "AsyncQueries(manager=None, threads=4)\n\n"
+         "Non-blocking, batched asset queries, run on a pool of worker threads.\n\n"
+         "The configured default manager is used, unless an\n"
+         "openassetio.hostApi.Manager is given. Each query returns a\n"
+         "concurrent.futures.Future, and any callback is added as a done\n"
+         "callback. Callbacks run on a worker thread, so UIs should hand\n"
+         "results to the main thread, e.g. via a queued Qt signal.")},
+    {Py_tp_new, reinterpret_cast<void*>(&PyType_GenericNew)},
+    {Py_tp_init, reinterpret_cast<void*>(&AsyncQueries_init)},
+    {Py_tp_dealloc, reinterpret_cast<void*>(&AsyncQueries_dealloc)},
+    {Py_tp_methods, static_cast<void*>(kAsyncQueriesMethods)},
+    {0, nullptr},
+};
+
+PyType_Spec kAsyncQueriesSpec = {
+    "KatanaOpenAssetIOAsync.AsyncQueries",
+    sizeof(PyAsyncQueries),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    kAsyncQueriesSlots,
+};
+
+PyModuleDef kModuleDef = {
+    PyModuleDef_HEAD_INIT,
+    "KatanaOpenAssetIOAsync",
+    "Non-blocking asset queries via the KatanaOpenAssetIO plugin's manager configuration.",
+    -1,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+};
+}  // namespace
+
+PyMODINIT_FUNC PyInit_KatanaOpenAssetIOAsync()
+{
+    PyObjectRef module{PyModule_Create(&kModuleDef)};
+    if (module.ptr == nullptr)
+    {
+        return nullptr;
+    }
+
+    // Such that manager calls this module's queries block on release
+    // the GIL, whether or not the manager is implemented in Python.
+    try
+    {
+        PythonBridge::Load();
+    }
+    catch (const std::exception& exc)
+    {
+        PyErr_SetString(PyExc_ImportError, exc.what());
+        return nullptr;
+    }
+
+    if (gFutureType == nullptr)
+    {
+        const PyObjectRef futures{PyImport_ImportModule("concurrent.futures")};
+        if (futures.ptr == nullptr)
+        {
+            return nullptr;
+        }
+        // Kept for the lifetime of the process.
+        gFutureType = PyObject_GetAttrString(futures.ptr, "Future");
+        if (gFutureType == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    PyObjectRef type{PyType_FromSpec(&kAsyncQueriesSpec)};
+    if (type.ptr == nullptr || PyModule_AddObject(module.ptr, "AsyncQueries", type.ptr) < 0)
+    {
+        return nullptr;
+    }
+    // Stolen by PyModule_AddObject.
+    type.release();
+    return module.release();
+}
@@ -0,0 +1,181 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "CallLog.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace CallLog
+{
+namespace
+{
+void appendString(std::string& out, const std::string_view str)
+{
+    const auto size = static_cast<std::uint32_t>(str.size());
+    out.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    out.append(str);
+}
+
+bool readString(std::string_view& cursor, std::string_view& str)
+{
+    std::uint32_t size = 0;
+    if (cursor.size() < sizeof(size))
+    {
+        return false;
+    }
+    std::memcpy(&size, cursor.data(), sizeof(size));
+    cursor.remove_prefix(sizeof(size));
+    if (cursor.size() < size)
+    {
+        return false;
+    }
+    str = cursor.substr(0, size);
+    cursor.remove_prefix(size);
+    return true;
+}
+}  // namespace
+
+const char* MethodName(const Method method)
+{
+    switch (method)
+    {
+        case Method::kReset:
+            return "reset";
+        case Method::kIsAssetId:
+            return "isAssetId";
+        case Method::kContainsAssetId:
+            return "containsAssetId";
+        case Method::kCheckPermissions:
+            return "checkPermissions";
+        case Method::kRunAssetPluginCommand:
+            return "runAssetPluginCommand";
+        case Method::kResolveAsset:
+            return "resolveAsset";
+        case Method::kResolveAllAssets:
+            return "resolveAllAssets";
+        case Method::kResolvePath:
+            return "resolvePath";
+        case Method::kResolveAssetVersion:
+            return "resolveAssetVersion";
+        case Method::kGetUniqueScenegraphLocationFromAssetId:
+            return "getUniqueScenegraphLocationFromAssetId";
+        case Method::kGetAssetDisplayName:
+            return "getAssetDisplayName";
+        case Method::kGetAssetVersions:
+            return "getAssetVersions";
+        case Method::kGetRelatedAssetId:
+            return "getRelatedAssetId";
+        case Method::kGetAssetFields:
+            return "getAssetFields";
+        case Method::kBuildAssetId:
+            return "buildAssetId";
+        case Method::kGetAssetAttributes:
+            return "getAssetAttributes";
+        case Method::kSetAssetAttributes:
+            return "setAssetAttributes";
+        case Method::kGetAssetIdForScope:
+            return "getAssetIdForScope";
+        case Method::kCreateAssetAndPath:
+            return "createAssetAndPath";
+        case Method::kPostCreateAsset:
+            return "postCreateAsset";
+        case Method::kCount:
+            break;
+    }
+    return "unknown";
+}
+
+void EncodeStringMap(const StringMap& map, std::string& out)
+{
+    out.clear();
+    for (const auto& [key, value] : map)
+    {
+        appendString(out, key);
+        appendString(out, value);
+    }
+}
+
+bool DecodeStringMap(std::string_view encoded, StringMap& map)
+{
+    map.clear();
+    while (!encoded.empty())
+    {
+        std::string_view key;
+        std::string_view value;
+        if (!readString(encoded, key) || !readString(encoded, value))
+        {
+            return false;
+        }
+        map.emplace(key, value);
+    }
+    return true;
+}
+
+std::vector<Record> ReadLog(const std::string& path, FileHeader& header)
+{
+    std::ifstream stream{path, std::ios::binary};
+    if (!stream)
+    {
+        throw std::runtime_error{"Unable to open call log '" + path + "'"};
+    }
+    const std::string contents{std::istreambuf_iterator<char>{stream},
+                               std::istreambuf_iterator<char>{}};
+
+    std::string_view cursor = contents;
+    if (cursor.size() < sizeof(FileHeader))
+    {
+        throw std::runtime_error{"'" + path + "' is not a call log"};
+    }
+    std::memcpy(&header, cursor.data(), sizeof(header));
+    cursor.remove_prefix(sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+    {
+        throw std::runtime_error{"'" + path + "' is not a call log"};
+    }
+    if (header.version != kVersion)
+    {
+        throw std::runtime_error{"Unsupported call log version " +
+                                 std::to_string(header.version) + " in '" + path + "'"};
+    }
+
+    std::vector<Record> records;
+    RecordHeader recordHeader{};
+    while (cursor.size() >= sizeof(RecordHeader))
+    {
+        std::memcpy(&recordHeader, cursor.data(), sizeof(recordHeader));
+        if (cursor.size() - sizeof(RecordHeader) < recordHeader.argsSize)
+        {
+            break;
+        }
+        cursor.remove_prefix(sizeof(RecordHeader));
+        std::string_view args = cursor.substr(0, recordHeader.argsSize);
+        cursor.remove_prefix(recordHeader.argsSize);
+
+        if (recordHeader.method >= Method::kCount)
+        {
+            throw std::runtime_error{"Unknown method in call log '" + path + "'"};
+        }
+
+        Record& record = records.emplace_back();
+        record.method = recordHeader.method;
+        record.outcome = recordHeader.outcome;
+        record.threadIndex = recordHeader.threadIndex;
+        record.startNs = recordHeader.startNs;
+        record.durationNs = recordHeader.durationNs;
+        record.args.reserve(recordHeader.argCount);
+        for (std::uint16_t idx = 0; idx < recordHeader.argCount; ++idx)
+        {
+            std::string_view arg;
+            if (!readString(args, arg))
+            {
+                throw std::runtime_error{"Malformed record in call log '" + path + "'"};
+            }
+            record.args.emplace_back(arg);
+        }
+    }
+    return records;
+}
+}  // namespace CallLog
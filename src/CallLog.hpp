@@ -0,0 +1,129 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Binary format of AssetAPI call logs, as written by CallRecorder and
+ * read by the replay tool.
+ *
+ * A log is a FileHeader followed by a sequence of records, each a
+ * RecordHeader followed by its arguments. Each argument is a
+ * little-endian uint32 length followed by that many bytes. Arguments
+ * are the entry point's inputs, in declaration order, with bools
+ * encoded as "0"/"1", ints in decimal, and string maps encoded by
+ * EncodeStringMap. Transaction handles are not recorded.
+ */
+namespace CallLog
+{
+constexpr char kMagic[8] = {'K', 'O', 'A', 'I', 'O', 'R', 'E', 'C'};
+constexpr std::uint32_t kVersion = 1;
+
+// AssetAPI entry points. Values are persisted, so only ever append.
+enum class Method : std::uint8_t
+{
+    kReset = 0,
+    kIsAssetId,
+    kContainsAssetId,
+    kCheckPermissions,
+    kRunAssetPluginCommand,
+    kResolveAsset,
+    kResolveAllAssets,
+    kResolvePath,
+    kResolveAssetVersion,
+    kGetUniqueScenegraphLocationFromAssetId,
+    kGetAssetDisplayName,
+    kGetAssetVersions,
+    kGetRelatedAssetId,
+    kGetAssetFields,
+    kBuildAssetId,
+    kGetAssetAttributes,
+    kSetAssetAttributes,
+    kGetAssetIdForScope,
+    kCreateAssetAndPath,
+    kPostCreateAsset,
+    kCount
+};
+
+enum class Outcome : std::uint8_t
+{
+    kReturned = 0,
+    kThrew = 1
+};
+
+struct FileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t reserved;
+    // Wall-clock time recording started, in ns since the Unix epoch.
+    std::uint64_t startEpochNs;
+};
+
+struct RecordHeader
+{
+    // Size of the encoded arguments following this header.
+    std::uint32_t argsSize;
+    Method method;
+    Outcome outcome;
+    std::uint16_t argCount;
+    // Small integer identifying the calling thread.
+    std::uint32_t threadIndex;
+    std::uint32_t reserved;
+    // Time of the call, relative to the start of recording.
+    std::uint64_t startNs;
+    std::uint64_t durationNs;
+};
+
+static_assert(sizeof(FileHeader) == 24);
+static_assert(sizeof(RecordHeader) == 32);
+
+struct Record
+{
+    Method method;
+    Outcome outcome;
+    std::uint32_t threadIndex;
+    std::uint64_t startNs;
+    std::uint64_t durationNs;
+    std::vector<std::string> args;
+};
+
+using StringMap = std::map<std::string, std::string>;
+
+/**
+ * Human-readable name of a method, e.g. "resolveAsset".
+ */
+const char* MethodName(Method method);
+
+/**
+ * Encode a string map as a single argument.
+ */
+void EncodeStringMap(const StringMap& map, std::string& out);
+
+/**
+ * Decode an argument encoded by EncodeStringMap.
+ *
+ * @return False if the argument is malformed.
+ */
+bool DecodeStringMap(std::string_view encoded, StringMap& map);
+
+/**
+ * Read an entire call log.
+ *
+ * A truncated final record, as left by a process that crashed whilst
+ * recording, is ignored.
+ *
+ * @param path Path of the log.
+ * @param header Set to the log's header.
+ *
+ * @throws std::runtime_error if the log cannot be read or is not a
+ * call log of a supported version.
+ */
+std::vector<Record> ReadLog(const std::string& path, FileHeader& header);
+}  // namespace CallLog
@@ -0,0 +1,159 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "CallRecorder.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace
+{
+constexpr std::size_t kWriteBufferSize = 1024 * 1024;
+
+// Whether the current thread is within a recorded entry point.
+thread_local bool tInCall = false;
+
+std::uint32_t currentThreadIndex()
+{
+    static std::atomic<std::uint32_t> nextIndex{0};
+    thread_local const std::uint32_t index = nextIndex++;
+    return index;
+}
+
+void appendEncoded(std::string& record, const std::string_view arg)
+{
+    const auto size = static_cast<std::uint32_t>(arg.size());
+    record.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    record.append(arg);
+}
+}  // namespace
+
+std::unique_ptr<CallRecorder> CallRecorder::open(const std::string& path)
+{
+#ifdef _WIN32
+    const std::string pid = std::to_string(_getpid());
+#else
+    const std::string pid = std::to_string(::getpid());
+#endif
+    std::string expandedPath = path;
+    for (std::size_t pos = expandedPath.find("%p"); pos != std::string::npos;
+         pos = expandedPath.find("%p", pos + pid.size()))
+    {
+        expandedPath.replace(pos, 2, pid);
+    }
+
+    std::FILE* file = std::fopen(expandedPath.c_str(), "wb");
+    if (file == nullptr)
+    {
+        throw std::runtime_error{"Unable to create call log '" + expandedPath + "'"};
+    }
+    std::setvbuf(file, nullptr, _IOFBF, kWriteBufferSize);
+
+    CallLog::FileHeader header{};
+    std::memcpy(header.magic, CallLog::kMagic, sizeof(header.magic));
+    header.version = CallLog::kVersion;
+    header.startEpochNs = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count());
+    std::fwrite(&header, sizeof(header), 1, file);
+
+    return std::unique_ptr<CallRecorder>{
+        new CallRecorder{file, std::chrono::steady_clock::now()}};
+}
+
+CallRecorder::CallRecorder(std::FILE* file, const std::chrono::steady_clock::time_point start)
+    : _file{file}, _start{start}
+{
+}
+
+CallRecorder::~CallRecorder()
+{
+    std::fclose(_file);
+}
+
+void CallRecorder::flush()
+{
+    const std::lock_guard lock{_mutex};
+    std::fflush(_file);
+}
+
+void CallRecorder::write(const std::string& record)
+{
+    const std::lock_guard lock{_mutex};
+    std::fwrite(record.data(), 1, record.size(), _file);
+}
+
+bool CallRecorder::Call::begin(const CallLog::Method method, const std::size_t argCount)
+{
+    if (tInCall)
+    {
+        // Nested entry point, which replays as part of the outer call.
+        _recorder = nullptr;
+        return false;
+    }
+    tInCall = true;
+    _uncaughtExceptions = std::uncaught_exceptions();
+
+    CallLog::RecordHeader header{};
+    header.method = method;
+    header.argCount = static_cast<std::uint16_t>(argCount);
+    _record.reserve(256);
+    _record.assign(reinterpret_cast<const char*>(&header), sizeof(header));
+    return true;
+}
+
+void CallRecorder::Call::appendArg(const std::string& arg)
+{
+    appendEncoded(_record, arg);
+}
+
+void CallRecorder::Call::appendArg(const bool arg)
+{
+    appendEncoded(_record, arg ? "1" : "0");
+}
+
+void CallRecorder::Call::appendArg(const int arg)
+{
+    appendEncoded(_record, std::to_string(arg));
+}
+
+void CallRecorder::Call::appendArg(const CallLog::StringMap& arg)
+{
+    std::string encoded;
+    CallLog::EncodeStringMap(arg, encoded);
+    appendEncoded(_record, encoded);
+}
+
+CallRecorder::Call::~Call()
+{
+    if (_recorder == nullptr)
+    {
+        return;
+    }
+    tInCall = false;
+
+    const auto end = std::chrono::steady_clock::now();
+    CallLog::RecordHeader header{};
+    std::memcpy(&header, _record.data(), sizeof(header));
+    header.argsSize = static_cast<std::uint32_t>(_record.size() - sizeof(header));
+    header.outcome = std::uncaught_exceptions() > _uncaughtExceptions
+                         ? CallLog::Outcome::kThrew
+                         : CallLog::Outcome::kReturned;
+    header.threadIndex = currentThreadIndex();
+    header.startNs = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(_start - _recorder->_start).count());
+    header.durationNs = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - _start).count());
+    std::memcpy(_record.data(), &header, sizeof(header));
+
+    _recorder->write(_record);
+}
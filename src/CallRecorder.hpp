@@ -0,0 +1,91 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "CallLog.hpp"
+
+/**
+ * Records AssetAPI entry point calls to a binary call log (see
+ * CallLog), for later offline replay.
+ *
+ * Records are appended through a large stdio buffer under a mutex, so
+ * the cost per call is an encode and a memcpy. Only the outermost
+ * entry point on a thread is recorded, such that entry points
+ * implemented in terms of others replay as they were called.
+ */
+class CallRecorder
+{
+public:
+    /**
+     * Create a recorder writing to a new log.
+     *
+     * @param path Path of the log. Any "%p" is replaced with the
+     * process ID, so that concurrent processes write separate logs.
+     *
+     * @throws std::runtime_error if the log cannot be created.
+     */
+    static std::unique_ptr<CallRecorder> open(const std::string& path);
+
+    ~CallRecorder();
+
+    CallRecorder(const CallRecorder&) = delete;
+    CallRecorder& operator=(const CallRecorder&) = delete;
+
+    /**
+     * Write buffered records to disk.
+     */
+    void flush();
+
+    /**
+     * Scoped record of a single entry point call, written on
+     * destruction along with the call's duration and whether it threw.
+     * Does nothing if constructed with a null recorder.
+     */
+    class Call
+    {
+    public:
+        template <typename... Args>
+        Call(CallRecorder* recorder, const CallLog::Method method, const Args&... args)
+            : _recorder{recorder}
+        {
+            if (_recorder != nullptr && begin(method, sizeof...(Args)))
+            {
+                (appendArg(args), ...);
+                _start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~Call();
+
+        Call(const Call&) = delete;
+        Call& operator=(const Call&) = delete;
+
+    private:
+        bool begin(CallLog::Method method, std::size_t argCount);
+        void appendArg(const std::string& arg);
+        void appendArg(bool arg);
+        void appendArg(int arg);
+        void appendArg(const CallLog::StringMap& arg);
+
+        CallRecorder* _recorder;
+        std::string _record;
+        int _uncaughtExceptions{0};
+        std::chrono::steady_clock::time_point _start;
+    };
+
+private:
+    CallRecorder(std::FILE* file, std::chrono::steady_clock::time_point start);
+
+    void write(const std::string& record);
+
+    std::FILE* _file;
+    const std::chrono::steady_clock::time_point _start;
+    std::mutex _mutex;
+};
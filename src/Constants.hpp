@@ -9,4 +9,56 @@ namespace Constants
 {
 inline const std::string kAssetId = "__assetId";
 constexpr std::size_t kPageSize{256};
+// Maximum number of log messages awaiting the asynchronous log writer.
+constexpr std::size_t kAsyncLogQueueCapacity{4096};
+
+constexpr const char* kDisablePythonEnvVar = "KATANAOPENASSETIO_DISABLE_PYTHON";
+// Path of the module providing the Python plugin system, overriding
+// the default location relative to the plugin.
+constexpr const char* kPythonBridgeEnvVar = "KATANAOPENASSETIO_PYTHON_BRIDGE";
+// Path of the resolver daemon's socket. If set, the plugin resolves via
+// the daemon.
+constexpr const char* kResolverSocketEnvVar = "KATANAOPENASSETIO_RESOLVER_SOCKET";
+// Milliseconds to wait for the resolver daemon to answer before falling
+// back to the in-process manager.
+constexpr const char* kResolverTimeoutEnvVar = "KATANAOPENASSETIO_RESOLVER_TIMEOUT_MS";
+constexpr std::size_t kDefaultResolverTimeoutMs{500};
+// If set, resolved locations are shared between processes on the host.
+constexpr const char* kSharedCacheEnvVar = "KATANAOPENASSETIO_SHARED_CACHE";
+constexpr const char* kSharedCacheSizeEnvVar = "KATANAOPENASSETIO_SHARED_CACHE_MB";
+constexpr std::size_t kDefaultSharedCacheMegabytes{64};
+// Path of a log to record AssetAPI calls to, for offline replay.
+constexpr const char* kRecordCallsEnvVar = "KATANAOPENASSETIO_RECORD_CALLS";
+// Deadline, in milliseconds, after which stale values are served whilst
+// the manager is queried in the background. Zero (the default) disables
+// stale serving.
+constexpr const char* kDeadlineEnvVar = "KATANAOPENASSETIO_DEADLINE_MS";
+constexpr const char* kRefreshThreadsEnvVar = "KATANAOPENASSETIO_REFRESH_THREADS";
+constexpr std::size_t kDefaultRefreshThreads{4};
+// Directory in which to cache which plugin provides the configured
+// manager, or "0" to always scan for plugins.
+constexpr const char* kDiscoveryCacheEnvVar = "KATANAOPENASSETIO_DISCOVERY_CACHE";
+// Limits on the manager requests this process makes: the number in
+// flight, and the sustained (per second) and burst start rates. Zero
+// (the default) means unlimited.
+constexpr const char* kMaxInFlightEnvVar = "KATANAOPENASSETIO_MAX_IN_FLIGHT";
+constexpr const char* kRateLimitEnvVar = "KATANAOPENASSETIO_RATE_LIMIT";
+constexpr const char* kRateBurstEnvVar = "KATANAOPENASSETIO_RATE_BURST";
+// Path of a snapshot of resolved values, loaded at startup and saved at
+// shutdown, such that sessions needn't start cold.
+constexpr const char* kSnapshotEnvVar = "KATANAOPENASSETIO_SNAPSHOT";
+// Number of values that may be speculatively prefetched but not yet
+// asked for. Zero (the default) disables prefetching.
+constexpr const char* kPrefetchBudgetEnvVar = "KATANAOPENASSETIO_PREFETCH_BUDGET";
+// Token from which to restore the manager session, rather than start a
+// new one, e.g. as exported by a parent process.
+constexpr const char* kContextTokenEnvVar = "KATANAOPENASSETIO_CONTEXT_TOKEN";
+// Memory, in megabytes, that cached values may occupy before the least
+// recently used are evicted. Zero (the default) means unlimited.
+constexpr const char* kCacheBudgetEnvVar = "KATANAOPENASSETIO_CACHE_BUDGET_MB";
+// As above, for the resolver daemon, which is long-lived and shared by
+// many processes, so is always bounded.
+constexpr std::size_t kDefaultResolverCacheBudgetMegabytes{512};
+// Worker threads of the Python async query module, by default.
+constexpr std::size_t kDefaultAsyncQueryThreads{4};
 };  // namespace Constants
\ No newline at end of file
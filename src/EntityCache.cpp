@@ -0,0 +1,441 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "EntityCache.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+constexpr std::size_t kInitialCapacity = 1024;
+// Puts between checks of memory usage against the budget, since
+// measuring it takes the string table's lock.
+constexpr std::size_t kBudgetCheckInterval = 64;
+
+// Layout of Slot::state, from the least significant bit.
+constexpr std::uint32_t kReferenced = 1;
+constexpr std::uint32_t kFieldShift = 1;
+constexpr std::uint32_t kFieldMask = 0x7;
+constexpr std::uint32_t kGenerationShift = 4;
+
+std::size_t hashKey(const StringTable::Handle assetId, const EntityCache::Field field)
+{
+    // Fibonacci hashing - spreads sequential handles across the table.
+    std::uint64_t key =
+        (static_cast<std::uint64_t>(assetId) << 8) | static_cast<std::uint64_t>(field);
+    key *= 0x9E3779B97F4A7C15ULL;
+    return static_cast<std::size_t>(key ^ (key >> 32));
+}
+}  // namespace
+
+EntityCache::Slot::Slot(const Slot& other)
+    : assetId{other.assetId},
+      value{other.value},
+      state{other.state.load(std::memory_order_relaxed)}
+{
+}
+
+EntityCache::Slot& EntityCache::Slot::operator=(const Slot& other)
+{
+    assetId = other.assetId;
+    value = other.value;
+    state.store(other.state.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+}
+
+EntityCache::EntityCache() : _slots(kInitialCapacity)
+{
+    static_assert(sizeof(Slot) == 12);
+    static_assert(static_cast<std::uint32_t>(Field::kStableVersionTag) <= kFieldMask);
+}
+
+bool EntityCache::get(const std::string_view assetId, const Field field, std::string& out) const
+{
+    // Hold the lock whilst reading strings, so that handles cannot be
+    // invalidated by a concurrent `clear()`.
+    const std::shared_lock lock{_mutex};
+    const Slot* slot = findLocked(assetId, field);
+    if (slot == nullptr || !isCurrentLocked(*slot))
+    {
+        return false;
+    }
+    touch(*slot);
+    out.clear();
+    _strings.appendTo(slot->value, out);
+    return true;
+}
+
+bool EntityCache::getStale(const std::string_view assetId,
+                           const Field field,
+                           std::string& out) const
+{
+    const std::shared_lock lock{_mutex};
+    const Slot* slot = findLocked(assetId, field);
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    touch(*slot);
+    out.clear();
+    _strings.appendTo(slot->value, out);
+    return true;
+}
+
+void EntityCache::put(const std::string_view assetId,
+                      const Field field,
+                      const std::string_view value)
+{
+    const std::unique_lock lock{_mutex};
+    putLocked(assetId, field, value);
+}
+
+bool EntityCache::put(const std::string_view assetId,
+                      const Field field,
+                      const std::string_view value,
+                      const Generation generation)
+{
+    const std::unique_lock lock{_mutex};
+    if (generation != _generation)
+    {
+        return false;
+    }
+    putLocked(assetId, field, value);
+    return true;
+}
+
+void EntityCache::forEach(const Visitor& visitor) const
+{
+    const std::shared_lock lock{_mutex};
+    std::string assetId;
+    std::string value;
+    for (const Slot& slot : _slots)
+    {
+        if (slot.assetId == StringTable::kInvalidHandle || !isCurrentLocked(slot))
+        {
+            continue;
+        }
+        assetId.clear();
+        _strings.appendTo(slot.assetId, assetId);
+        value.clear();
+        _strings.appendTo(slot.value, value);
+        visitor(assetId, fieldOf(slot), value);
+    }
+}
+
+void EntityCache::invalidate()
+{
+    const std::unique_lock lock{_mutex};
+    ++_generation;
+}
+
+void EntityCache::invalidate(const std::string_view assetId)
+{
+    const std::unique_lock lock{_mutex};
+    // Still bump the generation if nothing is cached for the entity,
+    // so that values being fetched for it concurrently are rejected.
+    const StringTable::Handle assetIdHandle = _strings.find(assetId);
+    invalidateLocked(
+        [assetIdHandle](const Slot& slot)
+        { return assetIdHandle != StringTable::kInvalidHandle && slot.assetId == assetIdHandle; });
+}
+
+void EntityCache::invalidate(const Field field)
+{
+    const std::unique_lock lock{_mutex};
+    invalidateLocked([field](const Slot& slot) { return fieldOf(slot) == field; });
+}
+
+std::size_t EntityCache::discardStale()
+{
+    const std::unique_lock lock{_mutex};
+    std::size_t discarded = 0;
+    for (Slot& slot : _slots)
+    {
+        if (slot.assetId != StringTable::kInvalidHandle && !isCurrentLocked(slot))
+        {
+            slot.assetId = StringTable::kInvalidHandle;
+            ++discarded;
+        }
+    }
+    _size -= discarded;
+    // Even if nothing was discarded, replaced values' strings remain.
+    compactLocked();
+    return discarded;
+}
+
+EntityCache::Generation EntityCache::generation() const
+{
+    const std::shared_lock lock{_mutex};
+    return _generation;
+}
+
+void EntityCache::clear()
+{
+    const std::unique_lock lock{_mutex};
+    std::vector<Slot>(kInitialCapacity).swap(_slots);
+    _size = 0;
+    _clockHand = 0;
+    _strings.clear();
+    // Values put against an earlier generation are now meaningless.
+    ++_generation;
+}
+
+std::size_t EntityCache::size() const
+{
+    const std::shared_lock lock{_mutex};
+    return _size;
+}
+
+std::size_t EntityCache::memoryUsage() const
+{
+    const std::shared_lock lock{_mutex};
+    return memoryUsageLocked();
+}
+
+void EntityCache::setBudget(const std::size_t budgetBytes)
+{
+    const std::unique_lock lock{_mutex};
+    _budget = budgetBytes;
+    if (_budget != 0 && valueUsageLocked() > _budget)
+    {
+        shrinkLocked(_budget * kLowWaterPercent / 100);
+    }
+}
+
+std::size_t EntityCache::shrink(const std::size_t targetBytes)
+{
+    const std::unique_lock lock{_mutex};
+    return shrinkLocked(targetBytes);
+}
+
+std::size_t EntityCache::trim()
+{
+    const std::unique_lock lock{_mutex};
+    const std::size_t limit = _budget != 0 ? _budget : valueUsageLocked();
+    return shrinkLocked(limit * kLowWaterPercent / 100);
+}
+
+std::uint32_t EntityCache::makeState(const Generation generation, const Field field)
+{
+    return (generation << kGenerationShift) | (static_cast<std::uint32_t>(field) << kFieldShift);
+}
+
+EntityCache::Field EntityCache::fieldOf(const Slot& slot)
+{
+    return static_cast<Field>((slot.state.load(std::memory_order_relaxed) >> kFieldShift) &
+                              kFieldMask);
+}
+
+bool EntityCache::isCurrentLocked(const Slot& slot) const
+{
+    const std::uint32_t state = slot.state.load(std::memory_order_relaxed);
+    return ((state ^ (_generation << kGenerationShift)) >> kGenerationShift) == 0;
+}
+
+const EntityCache::Slot* EntityCache::findLocked(const std::string_view assetId,
+                                                  const Field field) const
+{
+    const StringTable::Handle assetIdHandle = _strings.find(assetId);
+    if (assetIdHandle == StringTable::kInvalidHandle)
+    {
+        return nullptr;
+    }
+    const Slot& slot = _slots[probe(_slots, assetIdHandle, field)];
+    return slot.assetId == assetIdHandle ? &slot : nullptr;
+}
+
+std::size_t EntityCache::probe(const std::vector<Slot>& slots,
+                               const StringTable::Handle assetId,
+                               const Field field)
+{
+    const std::size_t mask = slots.size() - 1;
+    std::size_t idx = hashKey(assetId, field) & mask;
+    while (slots[idx].assetId != StringTable::kInvalidHandle &&
+           (slots[idx].assetId != assetId || fieldOf(slots[idx]) != field))
+    {
+        idx = (idx + 1) & mask;
+    }
+    return idx;
+}
+
+void EntityCache::touch(const Slot& slot)
+{
+    // Checked first, to avoid contending on the cache line when the
+    // value is already marked.
+    if ((slot.state.load(std::memory_order_relaxed) & kReferenced) == 0)
+    {
+        slot.state.fetch_or(kReferenced, std::memory_order_relaxed);
+    }
+}
+
+void EntityCache::putLocked(const std::string_view assetId,
+                            const Field field,
+                            const std::string_view value)
+{
+    const StringTable::Handle assetIdHandle = _strings.intern(assetId);
+    const StringTable::Handle valueHandle = _strings.intern(value);
+
+    if ((_size + 1) * 10 > _slots.size() * 7)
+    {
+        growLocked();
+    }
+    Slot& slot = _slots[probe(_slots, assetIdHandle, field)];
+    if (slot.assetId == StringTable::kInvalidHandle)
+    {
+        ++_size;
+    }
+    slot.assetId = assetIdHandle;
+    slot.value = valueHandle;
+    // Referenced, so spared by the next eviction sweep.
+    slot.state.store(makeState(_generation, field) | kReferenced, std::memory_order_relaxed);
+
+    if (_budget != 0 && ++_putsSinceBudgetCheck >= kBudgetCheckInterval)
+    {
+        _putsSinceBudgetCheck = 0;
+        if (valueUsageLocked() > _budget)
+        {
+            shrinkLocked(_budget * kLowWaterPercent / 100);
+        }
+    }
+}
+
+void EntityCache::growLocked()
+{
+    std::vector<Slot> slots(_slots.size() * 2);
+    for (const Slot& slot : _slots)
+    {
+        if (slot.assetId != StringTable::kInvalidHandle)
+        {
+            slots[probe(slots, slot.assetId, fieldOf(slot))] = slot;
+        }
+    }
+    _slots.swap(slots);
+}
+
+std::size_t EntityCache::memoryUsageLocked() const
+{
+    return _strings.memoryUsage() + _slots.capacity() * sizeof(Slot);
+}
+
+std::size_t EntityCache::valueUsageLocked() const
+{
+    // That of an empty cache, which no amount of eviction releases.
+    const std::size_t baseUsage = kInitialCapacity * sizeof(Slot) + StringTable::baseUsage();
+    const std::size_t usage = memoryUsageLocked();
+    return usage > baseUsage ? usage - baseUsage : 0;
+}
+
+void EntityCache::invalidateLocked(const std::function<bool(const Slot&)>& isStale)
+{
+    const Generation previous = _generation++;
+    const std::uint32_t generationMask = ~std::uint32_t{0} << kGenerationShift;
+    for (Slot& slot : _slots)
+    {
+        const std::uint32_t state = slot.state.load(std::memory_order_relaxed);
+        if (slot.assetId != StringTable::kInvalidHandle &&
+            (state & generationMask) == (previous << kGenerationShift) && !isStale(slot))
+        {
+            slot.state.store((state & ~generationMask) | (_generation << kGenerationShift),
+                             std::memory_order_relaxed);
+        }
+    }
+}
+
+std::size_t EntityCache::shrinkLocked(const std::size_t targetBytes)
+{
+    std::size_t evicted = 0;
+    for (std::size_t usage = valueUsageLocked(); usage > targetBytes && _size != 0;
+         usage = valueUsageLocked())
+    {
+        // Usage is roughly proportional to the number of values, but
+        // for shared prefixes and table growth, so this may fall
+        // short, in which case a further pass is made. Each pass
+        // evicts at least an eighth of the values, so that few
+        // compactions are needed.
+        const auto keep = static_cast<std::size_t>(static_cast<double>(_size) *
+                                                   static_cast<double>(targetBytes) /
+                                                   static_cast<double>(usage));
+        evicted += evictLocked(std::max(_size - std::min(keep, _size), _size / 8 + 1));
+        compactLocked();
+    }
+    return evicted;
+}
+
+std::size_t EntityCache::evictLocked(const std::size_t count)
+{
+    // Slots are emptied without regard for probe sequences, so the
+    // table must be compacted before it is next probed.
+    std::size_t evicted = 0;
+
+    // Stale values first, being only a fallback.
+    for (Slot& slot : _slots)
+    {
+        if (evicted == count)
+        {
+            break;
+        }
+        if (slot.assetId != StringTable::kInvalidHandle && !isCurrentLocked(slot))
+        {
+            slot.assetId = StringTable::kInvalidHandle;
+            ++evicted;
+        }
+    }
+
+    // Then those not looked up since the hand last passed. Every
+    // reference bit is cleared within one revolution, so this ends
+    // within two.
+    const std::size_t mask = _slots.size() - 1;
+    while (evicted < count)
+    {
+        Slot& slot = _slots[_clockHand];
+        _clockHand = (_clockHand + 1) & mask;
+        if (slot.assetId == StringTable::kInvalidHandle ||
+            (slot.state.fetch_and(~kReferenced, std::memory_order_relaxed) & kReferenced) != 0)
+        {
+            continue;
+        }
+        slot.assetId = StringTable::kInvalidHandle;
+        ++evicted;
+    }
+
+    _size -= evicted;
+    return evicted;
+}
+
+void EntityCache::compactLocked()
+{
+    // Drop the strings of evicted and replaced values, renumbering the
+    // rest, then rehash the survivors into a table sized for them.
+    std::vector<StringTable::Handle> handles;
+    handles.reserve(2 * _size);
+    for (const Slot& slot : _slots)
+    {
+        if (slot.assetId != StringTable::kInvalidHandle)
+        {
+            handles.push_back(slot.assetId);
+            handles.push_back(slot.value);
+        }
+    }
+    const std::vector<StringTable::Handle> remap = _strings.retain(handles);
+
+    std::size_t capacity = kInitialCapacity;
+    while (_size * 10 > capacity * 7)
+    {
+        capacity *= 2;
+    }
+    std::vector<Slot> slots(capacity);
+    for (const Slot& slot : _slots)
+    {
+        if (slot.assetId == StringTable::kInvalidHandle)
+        {
+            continue;
+        }
+        Slot& target = slots[probe(slots, remap[slot.assetId], fieldOf(slot))];
+        target = slot;
+        target.assetId = remap[slot.assetId];
+        target.value = remap[slot.value];
+    }
+    _slots.swap(slots);
+    _clockHand &= capacity - 1;
+}
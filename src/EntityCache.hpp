@@ -0,0 +1,245 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "StringTable.hpp"
+
+/**
+ * Thread-safe cache of values resolved from the manager, keyed by
+ * asset ID and field.
+ *
+ * Asset IDs and values are interned in a prefix-compressed
+ * `StringTable`, and the lookup table itself is a flat open-addressed
+ * array of 32-bit handles. Each cached value costs a 12-byte slot,
+ * plus a 12-byte string table entry, its index records and the bytes
+ * not shared with a string already cached.
+ *
+ * Cached values are held until `clear()`, which should be called when
+ * Katana flushes its caches. Alternatively, `invalidate()` marks all
+ * values as stale, such that they are no longer returned by `get()`,
+ * but can still be retrieved by `getStale()` until replaced.
+ *
+ * Memory can be bounded by `setBudget()` or `shrink()`, which evict
+ * stale values, then those least recently used. Recency is
+ * approximated by CLOCK: lookups set a per-value reference bit, and an
+ * eviction sweep spares values with the bit set, clearing it. Since
+ * interned strings cannot be freed individually, eviction then
+ * compacts the string table down to the surviving values, and rehashes
+ * the lookup table with their renumbered handles.
+ *
+ * Budgets bound the memory held beyond that of an empty cache, which
+ * is around 80KB, so that a small budget doesn't evict every value.
+ */
+class EntityCache
+{
+public:
+    /// Per-entity values that may be cached.
+    enum class Field : std::uint8_t
+    {
+        /// File system path resolved from the LocatableContent trait.
+        kLocation,
+        /// Name from the DisplayName trait.
+        kDisplayName,
+        /// Specified tag from the Version trait.
+        kVersionTag,
+        /// Newline-separated IDs of the traits the entity has.
+        kEntityTraits,
+        /// Newline-terminated version tags of all versions of the
+        /// entity.
+        kVersions,
+        /// Asset ID of the entity's version with a given tag, keyed by
+        /// the asset ID and tag, separated by a newline.
+        kVersionedAssetId,
+        /// Stable tag from the Version trait.
+        kStableVersionTag,
+    };
+
+    /// Incremented on each `invalidate()`. Slots store only the low
+    /// 28 bits, so a value is mistaken for current if the cache is
+    /// invalidated 2^28 times without it being replaced or evicted.
+    using Generation = std::uint32_t;
+
+    EntityCache();
+
+    /**
+     * Look up a cached value.
+     *
+     * @param assetId Asset ID as given by Katana.
+     * @param field Field to look up.
+     * @param out Set to the cached value, if found.
+     *
+     * @return Whether a cached value was found.
+     */
+    bool get(std::string_view assetId, Field field, std::string& out) const;
+
+    /**
+     * Look up a cached value, including one that has since been
+     * invalidated.
+     *
+     * @return Whether a cached value was found.
+     */
+    bool getStale(std::string_view assetId, Field field, std::string& out) const;
+
+    /**
+     * Add or replace a cached value.
+     */
+    void put(std::string_view assetId, Field field, std::string_view value);
+
+    /**
+     * Add or replace a cached value, unless the cache has been
+     * invalidated since `generation`, i.e. the value may pre-date the
+     * invalidation.
+     *
+     * @return Whether the value was added.
+     */
+    bool put(std::string_view assetId,
+             Field field,
+             std::string_view value,
+             Generation generation);
+
+    /// Receives an asset ID, field and value.
+    using Visitor = std::function<void(std::string_view, Field, std::string_view)>;
+
+    /**
+     * Call `visitor` for each cached value that is not stale. The cache
+     * is locked for reading throughout, so must not be modified by the
+     * visitor.
+     */
+    void forEach(const Visitor& visitor) const;
+
+    /**
+     * Mark all cached values as stale.
+     */
+    void invalidate();
+
+    /**
+     * Mark the cached values of an entity as stale, e.g. as it has
+     * been published to. Values since fetched for it are only accepted
+     * by `put` if given the generation current after this call.
+     */
+    void invalidate(std::string_view assetId);
+
+    /**
+     * Mark the cached values of a field as stale, for all entities.
+     * Values since fetched are accepted as above.
+     */
+    void invalidate(Field field);
+
+    /**
+     * Remove values that are stale, and release the memory held by
+     * them and by values since replaced.
+     *
+     * @return Number of values removed.
+     */
+    std::size_t discardStale();
+
+    /**
+     * @return The current generation, to later pass to `put`.
+     */
+    [[nodiscard]] Generation generation() const;
+
+    /**
+     * Remove all cached values.
+     */
+    void clear();
+
+    /**
+     * @return Number of cached values.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @return Approximate number of bytes held by the cache.
+     */
+    [[nodiscard]] std::size_t memoryUsage() const;
+
+    /**
+     * Limit the memory held by the cache. Once `memoryUsage()` exceeds
+     * that of an empty cache by more than the budget, values are
+     * evicted down to the low-water mark.
+     *
+     * @param budgetBytes Maximum bytes to hold, or zero (the default)
+     * for no limit.
+     */
+    void setBudget(std::size_t budgetBytes);
+
+    /**
+     * Evict values until the cache holds at most `targetBytes` more
+     * than an empty cache, or is empty.
+     *
+     * @return Number of values evicted.
+     */
+    std::size_t shrink(std::size_t targetBytes);
+
+    /**
+     * Evict values down to the low-water mark, being `kLowWaterPercent`
+     * of the budget, or of current usage beyond that of an empty cache
+     * if there is no budget.
+     *
+     * @return Number of values evicted.
+     */
+    std::size_t trim();
+
+    /// Percentage of the budget that eviction shrinks the cache to, so
+    /// that it doesn't immediately exceed the budget again.
+    static constexpr std::size_t kLowWaterPercent = 75;
+
+private:
+    struct Slot
+    {
+        // Invalid if the slot is empty.
+        StringTable::Handle assetId{StringTable::kInvalidHandle};
+        StringTable::Handle value{StringTable::kInvalidHandle};
+        // Generation, field and CLOCK reference bit, the last of which
+        // lookups set under a shared lock.
+        mutable std::atomic<std::uint32_t> state{0};
+
+        Slot() = default;
+        Slot(const Slot& other);
+        Slot& operator=(const Slot& other);
+    };
+
+    static std::uint32_t makeState(Generation generation, Field field);
+    static Field fieldOf(const Slot& slot);
+    [[nodiscard]] bool isCurrentLocked(const Slot& slot) const;
+    [[nodiscard]] const Slot* findLocked(std::string_view assetId, Field field) const;
+    // Index of the slot holding the field of the asset ID, or of the
+    // empty slot it would be inserted into.
+    static std::size_t probe(const std::vector<Slot>& slots,
+                             StringTable::Handle assetId,
+                             Field field);
+    static void touch(const Slot& slot);
+    void putLocked(std::string_view assetId, Field field, std::string_view value);
+    void growLocked();
+    [[nodiscard]] std::size_t memoryUsageLocked() const;
+    [[nodiscard]] std::size_t valueUsageLocked() const;
+    // Bump the generation, restamping all current values that don't
+    // match `isStale` such that only those matching are stale.
+    void invalidateLocked(const std::function<bool(const Slot&)>& isStale);
+    std::size_t shrinkLocked(std::size_t targetBytes);
+    std::size_t evictLocked(std::size_t count);
+    void compactLocked();
+
+    StringTable _strings;
+
+    mutable std::shared_mutex _mutex;
+    // Open-addressed, power-of-two capacity.
+    std::vector<Slot> _slots;
+    std::size_t _size{0};
+    Generation _generation{0};
+
+    std::size_t _budget{0};
+    std::size_t _putsSinceBudgetCheck{0};
+    // Next slot for the eviction sweep to consider.
+    std::size_t _clockHand{0};
+};
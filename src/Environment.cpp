@@ -0,0 +1,42 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "Environment.hpp"
+
+#include <cstdlib>
+#include <string_view>
+
+namespace Environment
+{
+bool IsFlagSet(const char* name)
+{
+    const char* value = std::getenv(name);
+    return value != nullptr && std::string_view{value} != "0";
+}
+
+std::optional<std::string> GetString(const char* name)
+{
+    const char* value = std::getenv(name);
+    if (value == nullptr || *value == '\0')
+    {
+        return std::nullopt;
+    }
+    return std::string{value};
+}
+
+std::size_t GetUnsigned(const char* name, const std::size_t defaultValue)
+{
+    const char* value = std::getenv(name);
+    if (value == nullptr || *value == '\0')
+    {
+        return defaultValue;
+    }
+    char* end = nullptr;
+    const unsigned long long parsed = std::strtoull(value, &end, 10);
+    if (*end != '\0' || *value == '-')
+    {
+        return defaultValue;
+    }
+    return static_cast<std::size_t>(parsed);
+}
+}  // namespace Environment
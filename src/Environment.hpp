@@ -0,0 +1,24 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+// Helpers for reading plugin configuration from environment variables.
+namespace Environment
+{
+// Returns true if the named environment variable is set to anything
+// other than "0".
+bool IsFlagSet(const char* name);
+
+// Returns the value of the named environment variable, if set and
+// non-empty.
+std::optional<std::string> GetString(const char* name);
+
+// Returns the value of the named environment variable as an unsigned
+// integer, or `defaultValue` if unset or not a valid number.
+std::size_t GetUnsigned(const char* name, std::size_t defaultValue);
+}  // namespace Environment
@@ -0,0 +1,271 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "FileUrlPathConverter.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+constexpr std::string_view kFileUrlScheme{"file://"};
+
+enum CharClass : std::uint8_t
+{
+    kInvalid = 0,
+    kPlain,
+    kEscape
+};
+
+// Classification of URL path bytes. Anything not listed here may
+// require percent-encoding or normalisation by a URL parser, so is
+// left for OpenAssetIO to deal with.
+constexpr std::array<std::uint8_t, 256> makeCharClasses()
+{
+    std::array<std::uint8_t, 256> classes{};
+    for (char chr = 'a'; chr <= 'z'; ++chr)
+    {
+        classes[static_cast<unsigned char>(chr)] = kPlain;
+    }
+    for (char chr = 'A'; chr <= 'Z'; ++chr)
+    {
+        classes[static_cast<unsigned char>(chr)] = kPlain;
+    }
+    for (char chr = '0'; chr <= '9'; ++chr)
+    {
+        classes[static_cast<unsigned char>(chr)] = kPlain;
+    }
+    for (const char chr : std::string_view{"-._~!$&'()*+,;=:@/"})
+    {
+        classes[static_cast<unsigned char>(chr)] = kPlain;
+    }
+    classes[static_cast<unsigned char>('%')] = kEscape;
+    return classes;
+}
+
+constexpr std::array<std::uint8_t, 256> kCharClasses = makeCharClasses();
+
+int hexValue(const char chr)
+{
+    if (chr >= '0' && chr <= '9')
+    {
+        return chr - '0';
+    }
+    if (chr >= 'a' && chr <= 'f')
+    {
+        return chr - 'a' + 10;
+    }
+    if (chr >= 'A' && chr <= 'F')
+    {
+        return chr - 'A' + 10;
+    }
+    return -1;
+}
+
+#if defined(__SSE2__)
+// Whether all 16 bytes at `data` are alphanumeric or one of "-./_",
+// i.e. the characters that make up the vast majority of file paths.
+bool isPlainChunk(const char* data)
+{
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    // Bytes >= 0x80 are negative as signed chars, so fail every range.
+    const auto inRange = [&chunk](const char low, const char high)
+    {
+        return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(static_cast<char>(low - 1))),
+                             _mm_cmplt_epi8(chunk, _mm_set1_epi8(static_cast<char>(high + 1))));
+    };
+    __m128i plain = _mm_or_si128(inRange('a', 'z'), inRange('A', 'Z'));
+    // '-', '.', '/' and '0'-'9' are contiguous.
+    plain = _mm_or_si128(plain, inRange('-', '9'));
+    plain = _mm_or_si128(plain, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')));
+    return _mm_movemask_epi8(plain) == 0xFFFF;
+}
+#endif
+
+/**
+ * Check every byte of the path is one we can handle, and whether any
+ * percent-escapes need decoding.
+ */
+bool classifyPath(const std::string_view path, bool& hasEscapes)
+{
+    hasEscapes = false;
+    std::size_t idx = 0;
+    while (idx < path.size())
+    {
+        std::size_t chunkEnd = path.size();
+#if defined(__SSE2__)
+        if (path.size() - idx >= 16)
+        {
+            if (isPlainChunk(path.data() + idx))
+            {
+                idx += 16;
+                continue;
+            }
+            chunkEnd = idx + 16;
+        }
+#endif
+        for (; idx < chunkEnd; ++idx)
+        {
+            switch (kCharClasses[static_cast<unsigned char>(path[idx])])
+            {
+            case kPlain:
+                break;
+            case kEscape:
+                hasEscapes = true;
+                break;
+            default:
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Percent-decode, copying runs of literal bytes between escapes in
+ * bulk.
+ */
+bool percentDecode(const std::string_view path, std::string& out)
+{
+    out.clear();
+    out.reserve(path.size());
+    const char* cur = path.data();
+    const char* const end = path.data() + path.size();
+    while (cur < end)
+    {
+        const auto* escape = static_cast<const char*>(std::memchr(cur, '%', end - cur));
+        if (escape == nullptr)
+        {
+            out.append(cur, end);
+            break;
+        }
+        out.append(cur, escape);
+        if (end - escape < 3)
+        {
+            return false;
+        }
+        const int high = hexValue(escape[1]);
+        const int low = hexValue(escape[2]);
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+        const auto decoded = static_cast<char>((high << 4) | low);
+        // OpenAssetIO rejects encoded separators and NULs, so leave it
+        // to raise the appropriate error.
+        if (decoded == '/' || decoded == '\0')
+        {
+            return false;
+        }
+        out.push_back(decoded);
+        cur = escape + 3;
+    }
+    return true;
+}
+
+/**
+ * Whether a URL parser would normalise the path, i.e. it has "." or
+ * ".." segments, or empty segments.
+ */
+bool needsNormalisation(const std::string_view path)
+{
+    for (auto pos = path.find("/."); pos != std::string_view::npos; pos = path.find("/.", pos + 1))
+    {
+        const std::string_view rest = path.substr(pos + 2);
+        if (rest.empty() || rest.front() == '/')
+        {
+            return true;
+        }
+        if (rest.front() == '.' && (rest.size() == 1 || rest[1] == '/'))
+        {
+            return true;
+        }
+    }
+    return path.find("//") != std::string_view::npos;
+}
+}  // namespace
+
+void CachingFileUrlPathConverter::pathFromUrl(const std::string_view url, std::string& out)
+{
+    if (tryFastPathFromUrl(url, out))
+    {
+        return;
+    }
+    if (_memo.get(url, EntityCache::Field::kLocation, out))
+    {
+        return;
+    }
+    out = _converter.pathFromUrl(url);
+    _memo.put(url, EntityCache::Field::kLocation, out);
+}
+
+std::string CachingFileUrlPathConverter::pathFromUrl(const std::string_view url)
+{
+    std::string path;
+    pathFromUrl(url, path);
+    return path;
+}
+
+bool CachingFileUrlPathConverter::tryFastPathFromUrl(const std::string_view url, std::string& out)
+{
+#ifdef _WIN32
+    // Drive letters and UNC hosts make Windows paths a different
+    // beast - always defer to OpenAssetIO.
+    (void)url;
+    (void)out;
+    return false;
+#else
+    // Only "file:///..." - i.e. no host.
+    if (url.size() <= kFileUrlScheme.size() ||
+        url.compare(0, kFileUrlScheme.size(), kFileUrlScheme) != 0 ||
+        url[kFileUrlScheme.size()] != '/')
+    {
+        return false;
+    }
+    const std::string_view path = url.substr(kFileUrlScheme.size());
+
+    bool hasEscapes = false;
+    if (!classifyPath(path, hasEscapes))
+    {
+        return false;
+    }
+    if (hasEscapes)
+    {
+        if (!percentDecode(path, out))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        out.assign(path);
+    }
+    // Check the decoded path, since e.g. "%2e" is also a dot segment.
+    return !needsNormalisation(out);
+#endif
+}
+
+void CachingFileUrlPathConverter::clear()
+{
+    _memo.clear();
+}
+
+std::size_t CachingFileUrlPathConverter::memoryUsage() const
+{
+    return _memo.memoryUsage();
+}
+
+void CachingFileUrlPathConverter::setBudget(const std::size_t budgetBytes)
+{
+    _memo.setBudget(budgetBytes);
+}
+
+void CachingFileUrlPathConverter::trim()
+{
+    _memo.trim();
+}
@@ -0,0 +1,80 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <openassetio/utils/path.hpp>
+
+#include "EntityCache.hpp"
+
+/**
+ * Memoizing wrapper around OpenAssetIO's `FileUrlPathConverter`.
+ *
+ * The overwhelmingly common case of a plain `file:///` URL, with
+ * nothing but unreserved characters and simple percent-escapes, is
+ * converted directly, without a full URL parse. Anything else is
+ * delegated to OpenAssetIO, and the result memoized, so that edge
+ * cases retain OpenAssetIO's exact validation and error semantics.
+ */
+class CachingFileUrlPathConverter
+{
+public:
+    /**
+     * Convert a `file://` URL to a system path.
+     *
+     * @param url URL to convert.
+     * @param out Set to the converted path.
+     *
+     * @throws openassetio::errors::InputValidationException if the URL
+     * is not a valid file URL.
+     */
+    void pathFromUrl(std::string_view url, std::string& out);
+
+    /**
+     * Convenience overload returning the converted path.
+     */
+    [[nodiscard]] std::string pathFromUrl(std::string_view url);
+
+    /**
+     * Attempt conversion without consulting OpenAssetIO.
+     *
+     * Only URLs of the form `file:///...` whose path contains no
+     * characters requiring normalisation by a URL parser (e.g. dot
+     * segments, backslashes, query/fragment delimiters) are handled.
+     *
+     * @return Whether the URL was handled, in which case `out` is set
+     * to the converted path.
+     */
+    static bool tryFastPathFromUrl(std::string_view url, std::string& out);
+
+    /**
+     * Discard memoized conversions.
+     */
+    void clear();
+
+    /**
+     * @return Approximate number of bytes held by memoized conversions.
+     */
+    [[nodiscard]] std::size_t memoryUsage() const;
+
+    /**
+     * Limit the memory held by memoized conversions, as
+     * `EntityCache::setBudget`.
+     */
+    void setBudget(std::size_t budgetBytes);
+
+    /**
+     * Evict memoized conversions down to the low-water mark, as
+     * `EntityCache::trim`.
+     */
+    void trim();
+
+private:
+    openassetio::utils::FileUrlPathConverter _converter{};
+    // Keyed by URL, with the converted path as its location.
+    EntityCache _memo;
+};
@@ -0,0 +1,152 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "KatanaLoggerInterface.hpp"
+
+#include <string>
+
+#include <FnLogging/FnLogging.h>
+
+#include "Constants.hpp"
+
+FnLogSetup("OpenAssetIO");
+
+KatanaLoggerInterface::KatanaLoggerInterface(const bool async)
+{
+    if (async)
+    {
+        _queue = std::make_unique<LockFreeQueue<Message>>(Constants::kAsyncLogQueueCapacity);
+        _drainThread = std::thread{&KatanaLoggerInterface::drain, this};
+    }
+}
+
+KatanaLoggerInterface::~KatanaLoggerInterface()
+{
+    if (_drainThread.joinable())
+    {
+        {
+            const std::lock_guard lock{_wakeMutex};
+            _stop = true;
+        }
+        _wake.notify_one();
+        _drainThread.join();
+    }
+}
+
+void KatanaLoggerInterface::log(const Severity severity, const openassetio::Str& message)
+{
+    // Errors are rare and most useful if the process is about to die,
+    // so are always written immediately.
+    if (!_queue || severity >= Severity::kError)
+    {
+        logSync(severity, message);
+        return;
+    }
+    if (!_queue->tryPush(Message{severity, message}))
+    {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    // Only wake the drain thread if it has emptied the queue and is
+    // waiting, so that a burst of messages costs one notification.
+    // Pairs with the fence in drain(): either we see that it's waiting,
+    // or it sees our message before waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_drainWaiting.load(std::memory_order_relaxed) &&
+        _drainWaiting.exchange(false, std::memory_order_relaxed))
+    {
+        // Ensures the drain thread is waiting, rather than between
+        // checking _drainWaiting and waiting, so can't miss this.
+        {
+            const std::lock_guard lock{_wakeMutex};
+        }
+        _wake.notify_one();
+    }
+}
+
+bool KatanaLoggerInterface::isSeverityLogged(const Severity severity) const
+{
+    switch (severity)
+    {
+    case Severity::kDebugApi:
+    case Severity::kDebug:
+        return _fnLog.isSeverityEnabled(kFnLoggingSeverityDebug);
+    case Severity::kInfo:
+    case Severity::kProgress:
+        return _fnLog.isSeverityEnabled(kFnLoggingSeverityInfo);
+    case Severity::kWarning:
+        return _fnLog.isSeverityEnabled(kFnLoggingSeverityWarning);
+    case Severity::kError:
+        return _fnLog.isSeverityEnabled(kFnLoggingSeverityError);
+    case Severity::kCritical:
+        return _fnLog.isSeverityEnabled(kFnLoggingSeverityCritical);
+    }
+    return true;
+}
+
+void KatanaLoggerInterface::logSync(const Severity severity, const openassetio::Str& message)
+{
+    switch (severity)
+    {
+    case Severity::kDebugApi:
+    case Severity::kDebug:
+        FnLogDebug(message);
+        return;
+    case Severity::kInfo:
+    case Severity::kProgress:
+        FnLogInfo(message);
+        return;
+    case Severity::kWarning:
+        FnLogWarn(message);
+        return;
+    case Severity::kError:
+        FnLogError(message);
+        return;
+    case Severity::kCritical:
+        FnLogCritical(message);
+        return;
+    }
+
+    // Should never happen (check compiler warnings for unhandled `switch` case).
+    FnLogError("Unhandled log severity:" + message);
+}
+
+void KatanaLoggerInterface::drain()
+{
+    Message message;
+    while (true)
+    {
+        while (_queue->tryPop(message))
+        {
+            logSync(message.severity, message.text);
+        }
+        if (const std::size_t dropped = _dropped.exchange(0, std::memory_order_relaxed))
+        {
+            FnLogWarn("Asynchronous log queue full - dropped " << dropped << " messages");
+        }
+
+        std::unique_lock lock{_wakeMutex};
+        if (_stop)
+        {
+            break;
+        }
+        _drainWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_queue->tryPop(message))
+        {
+            // Logged since we last looked.
+            _drainWaiting.store(false, std::memory_order_relaxed);
+            lock.unlock();
+            logSync(message.severity, message.text);
+            continue;
+        }
+        // No timeout, so an idle session doesn't keep waking us.
+        _wake.wait(lock,
+                   [this] { return _stop || !_drainWaiting.load(std::memory_order_relaxed); });
+        _drainWaiting.store(false, std::memory_order_relaxed);
+    }
+    // Flush anything logged whilst we were stopping.
+    while (_queue->tryPop(message))
+    {
+        logSync(message.severity, message.text);
+    }
+}
@@ -0,0 +1,81 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include <openassetio/log/LoggerInterface.hpp>
+
+#include "LockFreeQueue.hpp"
+
+/**
+ * Log a message via a KatanaLoggerInterface, only formatting it if the
+ * severity is enabled. `msg` may be a `<<`-separated expression, as
+ * with Katana's `FnLog*` macros.
+ */
+#define KATANAOPENASSETIO_LOG(logger, severity, msg)                  \
+    do                                                                \
+    {                                                                 \
+        if ((logger).isSeverityLogged(severity))                      \
+        {                                                             \
+            std::ostringstream katanaOpenAssetIOLogBuf_;              \
+            katanaOpenAssetIOLogBuf_ << msg;                          \
+            (logger).log((severity), katanaOpenAssetIOLogBuf_.str()); \
+        }                                                             \
+    } while (false)
+
+/**
+ * Adapter forwarding OpenAssetIO logging to Katana's logging system.
+ *
+ * In asynchronous mode, messages below error severity are queued on a
+ * lock-free queue and written by a background thread, so that callers
+ * never block on logging I/O. If the queue is full, messages are
+ * dropped rather than block, and a count of dropped messages is
+ * logged once space is available.
+ */
+class KatanaLoggerInterface final : public openassetio::log::LoggerInterface
+{
+public:
+    /**
+     * @param async Whether to write messages on a background thread.
+     */
+    explicit KatanaLoggerInterface(bool async);
+
+    ~KatanaLoggerInterface() override;
+
+    void log(Severity severity, const openassetio::Str& message) override;
+
+    /**
+     * Query Katana's configured log level, so that messages can be
+     * skipped before they are formatted.
+     */
+    [[nodiscard]] bool isSeverityLogged(Severity severity) const override;
+
+private:
+    struct Message
+    {
+        Severity severity{Severity::kDebug};
+        openassetio::Str text;
+    };
+
+    static void logSync(Severity severity, const openassetio::Str& message);
+    void drain();
+
+    std::unique_ptr<LockFreeQueue<Message>> _queue;
+    std::atomic<std::size_t> _dropped{0};
+    std::atomic<bool> _stop{false};
+    // Set whilst the drain thread waits for messages.
+    std::atomic<bool> _drainWaiting{false};
+    std::mutex _wakeMutex;
+    std::condition_variable _wake;
+    std::thread _drainThread;
+};
+
+using KatanaLoggerInterfacePtr = std::shared_ptr<KatanaLoggerInterface>;
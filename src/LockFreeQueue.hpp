@@ -0,0 +1,135 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * Bounded, lock-free, multi-producer multi-consumer queue.
+ *
+ * An implementation of Dmitry Vyukov's bounded MPMC queue, where each
+ * cell carries a sequence number that tells producers and consumers
+ * whether it is free to write or ready to read. Neither `tryPush` nor
+ * `tryPop` ever block; they fail if the queue is full or empty,
+ * respectively.
+ */
+template <typename T>
+class LockFreeQueue
+{
+public:
+    /**
+     * @param capacity Maximum number of queued elements. Must be a
+     * power of two.
+     */
+    explicit LockFreeQueue(const std::size_t capacity)
+        : _cells{new Cell[capacity]}, _mask{capacity - 1}
+    {
+        if (capacity < 2 || (capacity & _mask) != 0)
+        {
+            throw std::invalid_argument{"LockFreeQueue capacity must be a power of two"};
+        }
+        for (std::size_t idx = 0; idx < capacity; ++idx)
+        {
+            _cells[idx].sequence.store(idx, std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    /**
+     * Enqueue an element, unless the queue is full.
+     *
+     * @return Whether the element was enqueued.
+     */
+    bool tryPush(T&& value)
+    {
+        Cell* cell;
+        std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell = &_cells[pos & _mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0)
+            {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Dequeue an element, unless the queue is empty.
+     *
+     * @return Whether an element was dequeued into `value`.
+     */
+    bool tryPop(T& value)
+    {
+        Cell* cell;
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell = &_cells[pos & _mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff =
+                static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->data);
+        cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @return Maximum number of queued elements.
+     */
+    [[nodiscard]] std::size_t capacity() const { return _mask + 1; }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        T data;
+    };
+
+    static constexpr std::size_t kCacheLineSize = 64;
+
+    std::unique_ptr<Cell[]> _cells;
+    const std::size_t _mask;
+    // Separate cache lines, so producers and consumers don't contend.
+    alignas(kCacheLineSize) std::atomic<std::size_t> _enqueuePos{0};
+    alignas(kCacheLineSize) std::atomic<std::size_t> _dequeuePos{0};
+};
@@ -0,0 +1,281 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ManagerLoader.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ManagerFactory.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerImplementationFactory.hpp>
+#include <openassetio/pluginSystem/HybridPluginSystemManagerImplementationFactory.hpp>
+
+#include "Constants.hpp"
+#include "Environment.hpp"
+#include "PluginDiscoveryCache.hpp"
+#include "PythonBridge.hpp"
+
+namespace
+{
+using openassetio::hostApi::ManagerImplementationFactoryInterface;
+using openassetio::hostApi::ManagerImplementationFactoryInterfacePtr;
+using openassetio::log::LoggerInterface;
+using openassetio::log::LoggerInterfacePtr;
+
+ManagerImplementationFactoryInterfacePtr makeFactory(const PluginDiscoveryCache::Entry& entry,
+                                                     const LoggerInterfacePtr& logger)
+{
+    using openassetio::pluginSystem::CppPluginSystemManagerImplementationFactory;
+    using openassetio::pluginSystem::HybridPluginSystemManagerImplementationFactory;
+
+    if (entry.pythonSearchPath.empty())
+    {
+        return CppPluginSystemManagerImplementationFactory::make(entry.cppSearchPath, logger);
+    }
+    if (entry.cppSearchPath.empty())
+    {
+        return PythonBridge::MakePluginSystemFactory(logger, &entry.pythonSearchPath);
+    }
+    return HybridPluginSystemManagerImplementationFactory::make(
+        {CppPluginSystemManagerImplementationFactory::make(entry.cppSearchPath, logger),
+         PythonBridge::MakePluginSystemFactory(logger, &entry.pythonSearchPath)},
+        logger);
+}
+
+// Find the first search path entry with a plugin for `identifier`,
+// i.e. the one the plugin system would use, scanning one entry at a
+// time so that we can stop once it's found.
+template <typename MakeFactory>
+std::string findSearchPath(const std::vector<std::string>& searchPaths,
+                           const std::string& identifier,
+                           const MakeFactory& makeSearchPathFactory)
+{
+    for (const std::string& searchPath : searchPaths)
+    {
+        const auto identifiers = makeSearchPathFactory(searchPath)->identifiers();
+        if (std::find(identifiers.begin(), identifiers.end(), identifier) != identifiers.end())
+        {
+            return searchPath;
+        }
+    }
+    return {};
+}
+
+// Load the default manager using only the plugin(s) that provide it,
+// as recorded in the plugin discovery cache, or otherwise found by an
+// incremental scan and then recorded.
+//
+// Returns null if the provider can't be determined this way, e.g. if
+// the config file can't be parsed, or the plugin is provided by a
+// Python entry point rather than the search path.
+openassetio::hostApi::ManagerPtr loadUsingDiscoveryCache(
+    const openassetio::hostApi::HostInterfacePtr& hostInterface,
+    const LoggerInterfacePtr& logger,
+    const bool withPython)
+{
+    using openassetio::hostApi::ManagerFactory;
+    using openassetio::pluginSystem::CppPluginSystemManagerImplementationFactory;
+    using Severity = LoggerInterface::Severity;
+
+    const auto configPath =
+        Environment::GetString(ManagerFactory::kDefaultManagerConfigEnvVarName.data());
+    const auto pluginPaths =
+        Environment::GetString(CppPluginSystemManagerImplementationFactory::kPluginEnvVar.data());
+    if (!configPath || !pluginPaths)
+    {
+        return nullptr;
+    }
+    const auto cachePath = PluginDiscoveryCache::defaultPath(*configPath, *pluginPaths);
+    if (!cachePath)
+    {
+        return nullptr;
+    }
+    const auto identifier = PluginDiscoveryCache::readManagerIdentifier(*configPath);
+    if (!identifier)
+    {
+        return nullptr;
+    }
+
+    PluginDiscoveryCache cache{*cachePath};
+    if (const auto entry = cache.lookup(*identifier, *pluginPaths, withPython))
+    {
+        try
+        {
+            if (auto manager = ManagerFactory::defaultManagerForInterface(
+                    hostInterface, makeFactory(*entry, logger), logger))
+            {
+                logger->log(Severity::kDebug,
+                            "Loaded '" + *identifier + "' using plugin discovery cache " +
+                                cachePath->string());
+                return manager;
+            }
+        }
+        catch (const std::exception& exc)
+        {
+            // E.g. the plugin was modified in place.
+            logger->log(Severity::kDebug,
+                        std::string{"Plugin discovery cache entry failed to load: "} +
+                            exc.what() + " - rescanning");
+        }
+    }
+
+    PluginDiscoveryCache::Entry entry;
+    try
+    {
+        const std::vector<std::string> searchPaths =
+            PluginDiscoveryCache::splitSearchPaths(*pluginPaths);
+        entry.cppSearchPath =
+            findSearchPath(searchPaths,
+                           *identifier,
+                           [&logger](const std::string& searchPath)
+                           {
+                               return CppPluginSystemManagerImplementationFactory::make(searchPath,
+                                                                                        logger);
+                           });
+        if (withPython)
+        {
+            entry.pythonSearchPath =
+                findSearchPath(searchPaths,
+                               *identifier,
+                               [&logger](const std::string& searchPath)
+                               {
+                                   return PythonBridge::MakePluginSystemFactory(logger,
+                                                                                &searchPath);
+                               });
+        }
+    }
+    catch (const std::exception& exc)
+    {
+        logger->log(Severity::kDebug,
+                    std::string{"Incremental plugin scan failed: "} + exc.what() +
+                        " - scanning all plugins");
+        return nullptr;
+    }
+    if (entry.cppSearchPath.empty() && entry.pythonSearchPath.empty())
+    {
+        return nullptr;
+    }
+
+    auto manager = ManagerFactory::defaultManagerForInterface(
+        hostInterface, makeFactory(entry, logger), logger);
+    if (manager && !cache.store(*identifier, *pluginPaths, withPython, entry))
+    {
+        logger->log(Severity::kDebug,
+                    "Failed to write plugin discovery cache " + cachePath->string());
+    }
+    return manager;
+}
+}  // namespace
+
+namespace ManagerLoader
+{
+openassetio::hostApi::ManagerPtr LoadDefaultManager(
+    const openassetio::hostApi::HostInterfacePtr& hostInterface,
+    const openassetio::log::LoggerInterfacePtr& logger)
+{
+    using openassetio::hostApi::ManagerFactory;
+    using openassetio::hostApi::ManagerImplementationFactoryInterfacePtr;
+    using openassetio::pluginSystem::CppPluginSystemManagerImplementationFactory;
+    using openassetio::pluginSystem::HybridPluginSystemManagerImplementationFactory;
+
+    const bool withPython = !Environment::IsFlagSet(Constants::kDisablePythonEnvVar);
+
+    // Avoid scanning every plugin, if we can.
+    if (auto manager = loadUsingDiscoveryCache(hostInterface, logger, withPython))
+    {
+        return manager;
+    }
+
+    // Create the appropriate plugin system.
+    const auto managerImplFactory = [&]() -> ManagerImplementationFactoryInterfacePtr
+    {
+        if (!withPython)
+        {
+            // User has chosen to disable Python manager plugins. So
+            // just use the C++ plugin system.
+            return CppPluginSystemManagerImplementationFactory::make(logger);
+        }
+        // Support  C++ or Python or hybrid C++/Python plugins.
+        return HybridPluginSystemManagerImplementationFactory::make(
+            {// Plugin systems:
+             // C++ plugin system
+             CppPluginSystemManagerImplementationFactory::make(logger),
+             // Python plugin system, loaded on demand
+             PythonBridge::MakePluginSystemFactory(logger, nullptr)},
+            logger);
+    }();
+
+    auto manager =
+        ManagerFactory::defaultManagerForInterface(hostInterface, managerImplFactory, logger);
+
+    if (!manager)
+    {
+        throw openassetio::errors::ConfigurationException{
+            "No default OpenAssetIO manager configured. Set OPENASSETIO_DEFAULT_CONFIG."};
+    }
+    return manager;
+}
+
+std::string ConfigurationFingerprint()
+{
+    using openassetio::hostApi::ManagerFactory;
+    using openassetio::pluginSystem::CppPluginSystemManagerImplementationFactory;
+
+    std::string fingerprint;
+    if (const auto configPath =
+            Environment::GetString(ManagerFactory::kDefaultManagerConfigEnvVarName.data()))
+    {
+        fingerprint += *configPath;
+        std::error_code error;
+        const auto mtime = std::filesystem::last_write_time(*configPath, error);
+        if (!error)
+        {
+            fingerprint += '@';
+            fingerprint += std::to_string(mtime.time_since_epoch().count());
+        }
+    }
+    fingerprint += '\n';
+    fingerprint +=
+        Environment::GetString(CppPluginSystemManagerImplementationFactory::kPluginEnvVar.data())
+            .value_or("");
+    fingerprint += '\n';
+    fingerprint += Environment::IsFlagSet(Constants::kDisablePythonEnvVar) ? '0' : '1';
+    return fingerprint;
+}
+
+openassetio::ContextPtr CreateContext(const openassetio::hostApi::ManagerPtr& manager,
+                                      const openassetio::log::LoggerInterfacePtr& logger)
+{
+    using openassetio::log::LoggerInterface;
+
+    // Read once, as the environment may not be read safely whilst
+    // another thread (e.g. Python's os.environ) modifies it.
+    static const std::optional<std::string> token =
+        Environment::GetString(Constants::kContextTokenEnvVar);
+    if (token)
+    {
+        try
+        {
+            if (auto context = manager->contextFromPersistenceToken(*token))
+            {
+                return context;
+            }
+        }
+        catch (const std::exception& exc)
+        {
+            // E.g. the session has expired, or the token was issued by
+            // a differently configured manager.
+            logger->log(LoggerInterface::Severity::kWarning,
+                        std::string{"Failed to restore context from "} +
+                            Constants::kContextTokenEnvVar + ": " + exc.what() +
+                            " - starting a new session");
+        }
+    }
+    return manager->createContext();
+}
+}  // namespace ManagerLoader
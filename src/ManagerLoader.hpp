@@ -0,0 +1,41 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+
+namespace ManagerLoader
+{
+// Signature of functions creating the manager used by the plugin.
+using LoadFunction = std::function<openassetio::hostApi::ManagerPtr(
+    const openassetio::hostApi::HostInterfacePtr&, const openassetio::log::LoggerInterfacePtr&)>;
+
+// Creates the manager configured by OPENASSETIO_DEFAULT_CONFIG, using
+// the C++ and (unless disabled via KATANAOPENASSETIO_DISABLE_PYTHON)
+// Python plugin systems.
+//
+// Throws ConfigurationException if no default manager is configured.
+openassetio::hostApi::ManagerPtr LoadDefaultManager(
+    const openassetio::hostApi::HostInterfacePtr& hostInterface,
+    const openassetio::log::LoggerInterfacePtr& logger);
+
+// Returns a summary of the configuration that LoadDefaultManager
+// depends on - the config file path and modification time, plugin
+// search path, and whether Python is disabled - such that a manager
+// need only be recreated if this changes.
+std::string ConfigurationFingerprint();
+
+// Creates a context for the manager, restoring the session from the
+// persistence token in KATANAOPENASSETIO_CONTEXT_TOKEN, if set when
+// first called, such that it reuses the manager's session state (e.g.
+// of a parent process). Falls back to a new context if the token is
+// rejected.
+openassetio::ContextPtr CreateContext(const openassetio::hostApi::ManagerPtr& manager,
+                                      const openassetio::log::LoggerInterfacePtr& logger);
+}  // namespace ManagerLoader
@@ -3,23 +3,47 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <FnAsset/plugin/FnAsset.h>
 
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/hostApi/ManagerFactory.hpp>
-#include <openassetio/utils/path.hpp>
-
+#include "AdmissionController.hpp"
+#include "AssetTable.hpp"
+#include "CallRecorder.hpp"
+#include "EntityCache.hpp"
+#include "FileUrlPathConverter.hpp"
+#include "KatanaLoggerInterface.hpp"
+#include "ManagerLoader.hpp"
+#include "Prefetcher.hpp"
 #include "PublishStrategies.hpp"
+#include "ResolveSnapshot.hpp"
+#include "ResolverClient.hpp"
+#include "SharedResolveCache.hpp"
+#include "StaleWhileRevalidate.hpp"
 
 class OpenAssetIOAsset : public FnKat::Asset
 {
 public:
     OpenAssetIOAsset();
 
+    /**
+     * Construct using the given function to create the manager, rather
+     * than the configured default. Used to drive the plugin outside of
+     * Katana, e.g. when replaying recorded calls.
+     */
+    explicit OpenAssetIOAsset(ManagerLoader::LoadFunction loadManagerFunction);
+
     ~OpenAssetIOAsset() override;
 
     /**
@@ -27,10 +51,52 @@ public:
     */
     static Asset* create() { return new OpenAssetIOAsset(); }
 
-    static void flush() {}
+    /**
+     * Evict cached values of every live instance down to their
+     * low-water mark, as `trim()`.
+     */
+    static void flush();
+
+    /**
+     * @return Counters for serving stale values when the manager is
+     * slow to respond, or nullopt if not enabled.
+     */
+    [[nodiscard]] std::optional<StaleWhileRevalidate::Counters> staleWhileRevalidateCounters()
+        const;
+
+    /**
+     * @return Counters for predictive prefetching, to judge whether it
+     * pays for itself, or nullopt if not enabled.
+     */
+    [[nodiscard]] std::optional<Prefetcher::Counters> prefetcherCounters() const;
+
+    /**
+     * @return A token from which other processes can restore this
+     * instance's manager session, by setting
+     * KATANAOPENASSETIO_CONTEXT_TOKEN to it.
+     */
+    [[nodiscard]] std::string contextPersistenceToken();
+
+    /**
+     * @return Approximate number of bytes held by cached values. The
+     * shared resolve cache and snapshot are fixed-size mappings, so are
+     * not included.
+     */
+    [[nodiscard]] std::size_t memoryUsage() const;
+
+    /**
+     * Evict cached values down to the low-water mark of the cache
+     * budget (or of current usage, if there is no budget), least
+     * recently used first, and have the manager discard its own cached
+     * state. Unlike `reset()`, the manager and context are kept.
+     */
+    void trim();
 
     /** @brief Reset will be called when Katana flushes its caches, giving the plugin a chance to
      * reset.
+     *
+     * Cached state is discarded and a new context created, but the manager is only recreated if
+     * its configuration has changed since it was loaded.
      */
     void reset() override;
 
@@ -154,6 +220,100 @@ public:
      */
     void getAssetVersions(const std::string& assetId, StringVector& ret) override;
 
+    /** @brief Returns the available versions of each of the given assets.
+     *
+     * Equivalent to calling getAssetVersions for each asset, but queries the manager in bulk, i.e.
+     * with one relationship query for all assets, and one resolve for all of their versions.
+     * Also available to Python via the "getAssetVersions" plugin command.
+     *
+     * @param assetIds The assets whose versions we want.
+     *
+     * @param ret Set to one list of versions per asset, in the same order. The list is empty for
+     * assets that could not be queried, which are logged as warnings.
+     *
+     * @return Whether versions were retrieved for every asset.
+     */
+    bool getAssetVersionsBulk(const StringVector& assetIds, std::vector<StringVector>& ret);
+
+    /// An asset ID and version tag, as given to buildAssetId.
+    using AssetVersion = std::pair<std::string, std::string>;
+
+    /** @brief Returns the asset ID of the given version of each of the given assets.
+     *
+     * Equivalent to calling buildAssetId with the version field for each asset, e.g. to update
+     * many assets to "latest", but queries the manager in bulk, i.e. with one relationship query
+     * per distinct version tag. Also available to Python via the "buildAssetIds" plugin command.
+     *
+     * @param assetVersions The assets, and the version of each that we want.
+     *
+     * @param ret Set to one asset ID per asset, in the same order. As for buildAssetId, this is
+     * the input asset ID if the manager has no such version. It is empty for assets that could not
+     * be queried, which are logged as warnings.
+     *
+     * @return Whether every asset could be queried.
+     */
+    bool getVersionedAssetIdsBulk(const std::vector<AssetVersion>& assetVersions,
+                                  StringVector& ret);
+
+    /** @brief Returns the given metadata of each of the given assets, e.g. to fill a table.
+     *
+     * Equivalent to calling the AssetAPI entry point corresponding to each column for each asset,
+     * but resolves the union of the traits needed for all columns with one query for all assets.
+     * Rows whose columns are all cached are not queried. Also available to Python via the
+     * "getAssetTable" plugin command, which fills the cache.
+     *
+     * @param assetIds The assets, one per row.
+     *
+     * @param columns The metadata wanted for each asset.
+     *
+     * @param ret Set to the table. Rows for assets that could not be queried are marked as failed,
+     * and logged as warnings.
+     *
+     * @return Whether every asset could be queried.
+     */
+    bool getAssetTable(const StringVector& assetIds,
+                       std::vector<AssetTable::Column> columns,
+                       AssetTable& ret);
+
+    /// Outcome of validating an asset reference.
+    struct Validation
+    {
+        enum class Status : std::uint8_t
+        {
+            /// The asset exists, and its file(s) exist on disk.
+            kOk,
+            /// Not a valid asset ID.
+            kInvalid,
+            /// The manager has no such asset.
+            kMissing,
+            /// The asset could not be resolved to a file path.
+            kUnresolved,
+            /// The resolved file path does not exist.
+            kFileMissing,
+        };
+
+        Status status{Status::kOk};
+        /// Resolved file path, if resolved.
+        std::string path;
+        /// Reason for failure, if any.
+        std::string message;
+    };
+
+    /** @brief Checks that each of the given assets exists and resolves to a file on disk.
+     *
+     * E.g. to check a scene before submitting it to a render farm. Unique assets are split into
+     * chunks, each checked on a worker thread with a batched entityExists, then a batched resolve,
+     * then a stat of each resolved path. For file sequences, any file of the sequence suffices.
+     * Also available to Python via the "validate" plugin command.
+     *
+     * @param assetIds The assets to validate, possibly repeated.
+     *
+     * @param ret Set to one result per asset, in the same order.
+     *
+     * @return Whether every asset is valid.
+     */
+    bool validateAssets(const StringVector& assetIds, std::vector<Validation>& ret);
+
     /** @brief Return asset id that is related to input asset, given a relationship type.
      *
      * A general function for getting related assets.  An current example in Katana is
@@ -201,6 +361,10 @@ public:
      * the asset itself.  This metadata may include fields such as asset creator, creation time,
      * etc.
      *
+     * Only the traits needed for the given scope are resolved: "name" gives the display name,
+     * "version" the display name and version, and a comma-separated list of trait IDs gives the
+     * properties of just those traits. Otherwise, all traits the entity has are resolved.
+     *
      * @param assetId Asset for which to return metadata.
      * @param scope Optional string specifying scope for metadata lookup, such as "name" or
      * "version".
@@ -284,14 +448,177 @@ public:
                          std::string& assetId) override;
 
 private:
+    /**
+     * A loaded manager, and the context to query it with. Replaced
+     * wholesale on reset, so that callers holding one (e.g. background
+     * queries) can keep using it whilst another thread resets.
+     */
+    struct Session
+    {
+        openassetio::hostApi::ManagerPtr manager;
+        openassetio::ContextPtr context;
+        /// The manager's entity reference prefix, if it has one.
+        std::optional<std::string> entityReferencePrefix;
+    };
+    using SessionPtr = std::shared_ptr<const Session>;
+
+    /**
+     * Load the configured manager and create a new context. Must be
+     * called with `_managerMutex` held.
+     */
+    void loadManager();
+
+    /**
+     * Return the current session, loading the manager on first use
+     * after a reset.
+     */
+    SessionPtr session();
+
+    /**
+     * Return the entity reference prefix of the resolver daemon's
+     * manager, or null if not resolving via the daemon, or its manager
+     * has no prefix. Lets asset IDs be recognised without loading a
+     * manager in this process.
+     */
+    const std::string* daemonEntityReferencePrefix();
+
+    /**
+     * Wait for permission to query the manager, if admission control is
+     * configured. The query must complete before the ticket is
+     * destroyed.
+     */
+    [[nodiscard]] AdmissionController::Ticket admit(AdmissionController::Priority priority);
+
     std::optional<openassetio::EntityReference> entityRefForAssetIdAndVersion(
+        const Session& session,
         const std::string& assetId,
         const std::string& desiredVersionTag);
 
+    /**
+     * Look up a cached value, falling back to the snapshot from an
+     * earlier session, if any, unless the field is revalidated (see
+     * `getStale`).
+     */
+    bool getCached(const std::string& assetId, EntityCache::Field field, std::string& out);
+
+    /**
+     * Look up a value to serve if the manager misses the deadline:
+     * either a cached value, including one since invalidated, or one
+     * from the snapshot. Where stale values can be served, snapshot
+     * values are only served this way, so are always revalidated.
+     */
+    bool getStale(const std::string& assetId, EntityCache::Field field, std::string& out);
+
+    /**
+     * Stop serving cached values of entities that have been published
+     * to, along with the versions of all entities, any of which may be
+     * a version of the published entity.
+     */
+    void invalidatePublished(const std::vector<std::string>& assetIds);
+
+    /**
+     * Save the cache as a snapshot for later sessions, if configured.
+     *
+     * @return Whether the snapshot was saved.
+     */
+    bool saveSnapshot();
+
+    /**
+     * Note a call for an asset, if prefetching, such that the calls
+     * likely to follow are prefetched.
+     */
+    void observe(CallLog::Method method, const std::string& assetId);
+
+    /**
+     * Fetch the values of the given entry point for many assets into
+     * the cache, on behalf of the prefetcher.
+     */
+    void prefetch(CallLog::Method method, const StringVector& assetIds);
+
+    /**
+     * @return Whether the value of the given entry point for an asset
+     * is cached, so needn't be prefetched.
+     */
+    bool isCached(CallLog::Method method, std::string_view assetId);
+
+    /**
+     * Return the traits an entity has, querying the manager only on
+     * first use since a reset.
+     */
+    openassetio::trait::TraitSet cachedEntityTraits(
+        const Session& session,
+        const std::string& assetId,
+        const openassetio::EntityReference& entityReference);
+
+    /**
+     * Query the manager for the file system path of an asset.
+     *
+     * @return Whether the path may be cached, i.e. the asset ID is to
+     * a specific version.
+     */
+    bool resolveLocationFromManager(const Session& session,
+                                    AdmissionController::Priority priority,
+                                    const std::string& assetId,
+                                    std::string& location);
+
+    /**
+     * Query the manager for the display name and version tag of an
+     * asset.
+     */
+    void resolveFieldsFromManager(const Session& session,
+                                  AdmissionController::Priority priority,
+                                  const std::string& assetId,
+                                  std::string& displayName,
+                                  std::string& versionTag);
+
+    /**
+     * Priority for a refresh posted with the given deadline: once the
+     * caller has stopped waiting, it no longer holds up interactive
+     * work.
+     */
+    static AdmissionController::Priority refreshPriority(
+        std::chrono::steady_clock::time_point deadline);
+
     PublishStrategies _publishStrategies;
+    EntityCache _entityCache;
 
+    KatanaLoggerInterfacePtr _logger;
+    // Set if resolving via the resolver daemon.
+    std::optional<std::string> _resolverSocketPath;
+    std::unique_ptr<ResolverClient> _resolverClient;
+    // The daemon's entity reference prefix, queried on first use, as it
+    // is constant for the lifetime of its manager.
+    std::mutex _daemonPrefixMutex;
+    std::atomic<bool> _daemonPrefixQueried{false};
+    std::optional<std::string> _daemonPrefix;
+    // Set if sharing resolved locations with other processes.
+    std::unique_ptr<SharedResolveCache> _sharedCache;
+    // Path to save a snapshot of the cache to, if configured.
+    std::string _snapshotPath;
+    // Set if serving values resolved in an earlier session.
+    std::unique_ptr<ResolveSnapshot> _snapshot;
+    // Set if recording calls for offline replay.
+    std::unique_ptr<CallRecorder> _recorder;
+
+    const ManagerLoader::LoadFunction _loadManagerFunction;
+
+    // Held to replace `_session`, which is otherwise read lock-free,
+    // via std::atomic_load, and written via std::atomic_store.
+    std::mutex _managerMutex;
+    SessionPtr _session;
     openassetio::hostApi::HostInterfacePtr _hostInterface;
-    openassetio::hostApi::ManagerPtr _manager;
-    openassetio::ContextPtr _context;
-    openassetio::utils::FileUrlPathConverter _fileUrlPathConverter{};
+    // Configuration the manager was loaded with, to determine whether
+    // it must be reloaded on reset.
+    std::string _managerFingerprint;
+    CachingFileUrlPathConverter _fileUrlPathConverter;
+    // Set if limiting the load placed on the manager.
+    std::unique_ptr<AdmissionController> _admissionController;
+
+    // Set if serving stale values when the manager is slow. Last but
+    // one, so that background queries are stopped before anything they
+    // use is destroyed.
+    std::unique_ptr<StaleWhileRevalidate> _staleWhileRevalidate;
+    // Set if prefetching values predicted to be asked for. Last, since
+    // it may query via any of the above.
+    std::unique_ptr<Prefetcher> _prefetcher;
 };
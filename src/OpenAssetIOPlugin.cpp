@@ -1,140 +1,768 @@
 // KatanaOpenAssetIO
 // Copyright (c) 2024 The Foundry Visionmongers Ltd
 // SPDX-License-Identifier: Apache-2.0
-#include <Python.h>
-
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <future>
 #include <iostream>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <optional>
 #include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 
 #ifndef _WIN32
 #include <pwd.h>
 #endif
 
 #include "Utilities.hpp"
-#include "config.hpp"
 
+#include "CallRecorder.hpp"
 #include "Constants.hpp"
+#include "Environment.hpp"
 #include "KatanaHostInterface.hpp"
+#include "KatanaLoggerInterface.hpp"
+#include "ManagerLoader.hpp"
 #include "OpenAssetIOAsset.hpp"
+#include "ScopedGilRelease.hpp"
+#include "ThreadPool.hpp"
 
 #include <openassetio/access.hpp>
 #include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/errors/exceptions.hpp>
-#include <openassetio/hostApi/ManagerFactory.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
-#include <openassetio/pluginSystem/CppPluginSystemManagerImplementationFactory.hpp>
-#include <openassetio/pluginSystem/HybridPluginSystemManagerImplementationFactory.hpp>
-#include <openassetio/python/hostApi.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 
 #include <openassetio_mediacreation/openassetio_mediacreation.hpp>
 
-#include <openassetio/utils/path.hpp>
-
 #include <FnAsset/FnDefaultFileSequencePlugin.h>
-#include <FnLogging/FnLogging.h>
 
 #include <FnAttribute/FnAttribute.h>
 
-FnLogSetup("OpenAssetIO");
-
 namespace
 {
-struct KatanaLoggerInterface : openassetio::log::LoggerInterface
+constexpr char kAssetFieldKeySep = '_';
+// Separates trait IDs given as a getAssetAttributes scope.
+constexpr char kTraitIdSep = ',';
+// Characters identifying a scope as a list of (namespaced) trait IDs.
+constexpr const char* kTraitIdScopeChars = ",:";
+// Plugin command listing versions of the newline-separated asset IDs
+// given by the "assetIds" argument (and/or the command's asset ID).
+constexpr std::string_view kGetAssetVersionsCommand{"getAssetVersions"};
+constexpr const char* kAssetIdsCommandArg = "assetIds";
+// Plugin command warming the cache for buildAssetId with the given
+// version of each of the "assetIds", given by the newline-separated
+// "versions" argument, or a single version for all of them.
+constexpr std::string_view kBuildAssetIdsCommand{"buildAssetIds"};
+constexpr const char* kVersionsCommandArg = "versions";
+// Plugin command warming the cache with the comma-separated "columns"
+// (see AssetTable::ParseColumn) of each of the "assetIds".
+constexpr std::string_view kGetAssetTableCommand{"getAssetTable"};
+constexpr const char* kColumnsCommandArg = "columns";
+constexpr char kColumnSep = ',';
+// Assumed size of a typical asset table value, to reserve space for
+// all values up front.
+constexpr std::size_t kAssetTableValueBytes = 48;
+// Plugin command validating the "assetIds", and writing a report to
+// the path given by the optional "report" argument.
+constexpr std::string_view kValidateCommand{"validate"};
+constexpr const char* kReportCommandArg = "report";
+// Assets are validated in chunks of this many unique assets, by up to
+// this many threads.
+constexpr std::size_t kValidateChunkSize = 256;
+constexpr std::size_t kValidateThreads = 8;
+// Plugin command saving the resolve snapshot, if configured.
+constexpr std::string_view kSaveSnapshotCommand{"saveSnapshot"};
+// Plugin command writing a token for the manager session to the file
+// given by the "path" argument, for a launcher to pass to child
+// processes.
+constexpr std::string_view kExportContextTokenCommand{"exportContextToken"};
+constexpr const char* kPathCommandArg = "path";
+// Plugin command evicting cached values down to the low-water mark.
+constexpr std::string_view kTrimCommand{"trim"};
+constexpr const char* kAsyncLoggingEnvVar = "KATANAOPENASSETIO_ASYNC_LOGGING";
+
+// Live instances, for the static `flush()` to trim.
+std::mutex gInstancesMutex;
+std::vector<OpenAssetIOAsset*> gInstances;
+
+// Trait sets and relationship queries used by the entry points, built
+// once rather than on every call. These are function-local statics
+// since the trait IDs are themselves dynamically initialised.
+namespace Queries
+{
+using openassetio::trait::TraitSet;
+using openassetio_mediacreation::traits::content::LocatableContentTrait;
+using openassetio_mediacreation::traits::identity::DisplayNameTrait;
+using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+using openassetio_mediacreation::traits::threeDimensional::SourcePathTrait;
+
+const TraitSet& LocationTraits()
+{
+    static const TraitSet kTraits{LocatableContentTrait::kId};
+    return kTraits;
+}
+
+// With the version, to tell whether the location may be cached.
+const TraitSet& CacheableLocationTraits()
+{
+    static const TraitSet kTraits{LocatableContentTrait::kId, VersionTrait::kId};
+    return kTraits;
+}
+
+const TraitSet& VersionTraits()
+{
+    static const TraitSet kTraits{VersionTrait::kId};
+    return kTraits;
+}
+
+const TraitSet& DisplayNameTraits()
+{
+    static const TraitSet kTraits{DisplayNameTrait::kId};
+    return kTraits;
+}
+
+const TraitSet& FieldTraits()
+{
+    static const TraitSet kTraits{DisplayNameTrait::kId, VersionTrait::kId};
+    return kTraits;
+}
+
+// Traits needed to fill an asset table column.
+const openassetio::trait::TraitId& ColumnTrait(const AssetTable::Column column)
+{
+    switch (column)
+    {
+        case AssetTable::Column::kName:
+            return DisplayNameTrait::kId;
+        case AssetTable::Column::kVersion:
+        case AssetTable::Column::kResolvedVersion:
+            return VersionTrait::kId;
+        case AssetTable::Column::kLocation:
+            return LocatableContentTrait::kId;
+        case AssetTable::Column::kScenegraphLocation:
+            return SourcePathTrait::kId;
+    }
+    throw std::invalid_argument{"Unknown asset table column"};
+}
+
+const TraitSet& ScenegraphLocationTraits(const bool includeVersion)
+{
+    static const TraitSet kTraits{SourcePathTrait::kId};
+    static const TraitSet kVersionedTraits{SourcePathTrait::kId, VersionTrait::kId};
+    return includeVersion ? kVersionedTraits : kTraits;
+}
+
+// Relationship to all versions of an entity. Never modified after
+// construction, so safe to share between concurrent queries.
+const openassetio::trait::TraitsDataPtr& AllVersionsRelationship()
+{
+    using openassetio_mediacreation::specifications::lifecycle::
+        EntityVersionsRelationshipSpecification;
+    static const openassetio::trait::TraitsDataPtr kRelationship =
+        EntityVersionsRelationshipSpecification::create().traitsData();
+    return kRelationship;
+}
+}  // namespace Queries
+
+// Version lists are cached as newline-terminated tags, such that an
+// empty string is an empty list.
+template <typename Iterator>
+void encodeVersions(Iterator first, const Iterator last, std::string& out)
+{
+    out.clear();
+    for (; first != last; ++first)
+    {
+        out += *first;
+        out += '\n';
+    }
+}
+
+void decodeVersions(std::string_view encoded, std::vector<std::string>& out)
+{
+    while (!encoded.empty())
+    {
+        const auto end = encoded.find('\n');
+        out.emplace_back(encoded.substr(0, end));
+        encoded.remove_prefix(end == std::string_view::npos ? encoded.size() : end + 1);
+    }
+}
+
+// Cache field holding the value of an asset table column, if any.
+std::optional<EntityCache::Field> columnCacheField(const AssetTable::Column column)
+{
+    switch (column)
+    {
+        case AssetTable::Column::kName:
+            return EntityCache::Field::kDisplayName;
+        case AssetTable::Column::kVersion:
+            return EntityCache::Field::kVersionTag;
+        case AssetTable::Column::kLocation:
+            return EntityCache::Field::kLocation;
+        case AssetTable::Column::kResolvedVersion:
+            return EntityCache::Field::kStableVersionTag;
+        case AssetTable::Column::kScenegraphLocation:
+            break;
+    }
+    return std::nullopt;
+}
+
+// Whether a reference is to a specific version, rather than to a
+// meta-version such as "latest" (or to no version, implying the
+// latest), whose stable tag changes as versions are published.
+bool isStableVersion(const openassetio::trait::TraitsDataPtr& traitsData)
+{
+    const openassetio_mediacreation::traits::lifecycle::VersionTrait versionTrait{traitsData};
+    const auto specifiedTag = versionTrait.getSpecifiedTag();
+    return specifiedTag && specifiedTag == versionTrait.getStableTag();
+}
+
+// Fields for which stale values are served whilst the manager is
+// queried, if a deadline is configured.
+bool isRevalidated(const EntityCache::Field field)
+{
+    return field == EntityCache::Field::kLocation || field == EntityCache::Field::kDisplayName ||
+           field == EntityCache::Field::kVersionTag;
+}
+
+const char* validationStatusName(const OpenAssetIOAsset::Validation::Status status)
+{
+    using Status = OpenAssetIOAsset::Validation::Status;
+    switch (status)
+    {
+        case Status::kOk:
+            return "ok";
+        case Status::kInvalid:
+            return "invalid";
+        case Status::kMissing:
+            return "missing";
+        case Status::kUnresolved:
+            return "unresolved";
+        case Status::kFileMissing:
+            return "fileMissing";
+    }
+    return "unknown";
+}
+
+// Write a validation report as tab-separated asset ID, status, path and
+// message, one asset per line.
+bool writeValidationReport(const std::string& reportPath,
+                           const std::vector<std::string>& assetIds,
+                           const std::vector<OpenAssetIOAsset::Validation>& validations)
+{
+    std::ofstream report{reportPath, std::ios::trunc};
+    for (std::size_t idx = 0; idx < assetIds.size(); ++idx)
+    {
+        const OpenAssetIOAsset::Validation& validation = validations[idx];
+        report << assetIds[idx] << '\t' << validationStatusName(validation.status) << '\t'
+               << validation.path << '\t' << validation.message << '\n';
+    }
+    return static_cast<bool>(report.flush());
+}
+
+// Writes a session token readable only by the current user, since it
+// grants access to the session.
+bool writeContextToken(const std::string& path, const std::string& token)
+{
+    std::ofstream file{path, std::ios::trunc};
+    std::error_code error;
+    // Before the token is written.
+    std::filesystem::permissions(path,
+                                 std::filesystem::perms::owner_read |
+                                     std::filesystem::perms::owner_write,
+                                 error);
+    if (error)
+    {
+        return false;
+    }
+    file << token;
+    return static_cast<bool>(file.flush());
+}
+
+// Whether a resolved path exists on disk. For a file sequence, whether
+// any file in its directory has the sequence's prefix, since which
+// frames are rendered isn't known.
+bool resolvedPathExists(const std::string& path)
 {
-    void log(Severity severity, const openassetio::Str& message) override
+    std::error_code error;
+    if (!FnKat::DefaultFileSequencePlugin::isFileSequence(path))
+    {
+        return std::filesystem::exists(path, error);
+    }
+    const std::filesystem::path sequencePath{path};
+    const std::string filename = sequencePath.filename().string();
+    const std::string prefix = filename.substr(0, filename.find_first_of("#%@"));
+    for (std::filesystem::directory_iterator entry{sequencePath.parent_path(), error}, end;
+         !error && entry != end;
+         entry.increment(error))
     {
-        switch (severity)
+        if (entry->path().filename().string().compare(0, prefix.size(), prefix) == 0)
         {
-        case Severity::kDebugApi:
-        case Severity::kDebug:
-            FnLogDebug(message);
-            return;
-        case Severity::kInfo:
-        case Severity::kProgress:
-            FnLogInfo(message);
-            return;
-        case Severity::kWarning:
-            FnLogWarn(message);
-            return;
-        case Severity::kError:
-            FnLogError(message);
-            return;
-        case Severity::kCritical:
-            FnLogCritical(message);
-            return;
+            return true;
         }
+    }
+    return false;
+}
 
-        // Should never happen (check compiler warnings for unhandled `switch` case).
-        FnLogError("Unhandled log severity:" + message);
+// Append each non-empty line of `lines` to `out`.
+void splitLines(std::string_view lines, std::vector<std::string>& out)
+{
+    while (!lines.empty())
+    {
+        const auto sep = lines.find('\n');
+        if (const auto line = lines.substr(0, sep); !line.empty())
+        {
+            out.emplace_back(line);
+        }
+        lines.remove_prefix(sep == std::string_view::npos ? lines.size() : sep + 1);
     }
+}
+
+// Cache key for the asset ID of a given version of an asset. Asset IDs
+// can't contain newlines, since they are newline-separated when given
+// to plugin commands.
+std::string versionedAssetIdKey(const std::string_view assetId, const std::string_view versionTag)
+{
+    std::string key;
+    key.reserve(assetId.size() + 1 + versionTag.size());
+    key += assetId;
+    key += '\n';
+    key += versionTag;
+    return key;
+}
+
+// Buffers reused by successive calls on the same thread.
+struct Scratch
+{
+    std::vector<std::string_view> assetIds;
+    std::vector<ResolverProtocol::Result> results;
 };
 
-constexpr char kAssetFieldKeySep = '_';
-constexpr const char* kDisablePythonEnvVar = "KATANAOPENASSETIO_DISABLE_PYTHON";
+Scratch& threadScratch()
+{
+    thread_local Scratch scratch;
+    return scratch;
+}
+
+// Format a trait property value as `std::ostream << std::boolalpha`
+// would, without constructing a stream for the common types.
+void formatPropertyValue(const openassetio::trait::property::Value& value, std::string& out)
+{
+    std::visit(
+        [&out](const auto& containedValue)
+        {
+            using Type = std::decay_t<decltype(containedValue)>;
+            if constexpr (std::is_same_v<Type, openassetio::Bool>)
+            {
+                out = containedValue ? "true" : "false";
+            }
+            else if constexpr (std::is_same_v<Type, openassetio::Int>)
+            {
+                out = std::to_string(containedValue);
+            }
+            else if constexpr (std::is_same_v<Type, openassetio::Float>)
+            {
+                // Matches the stream's default precision and notation.
+                char buffer[32];
+                std::snprintf(buffer, sizeof(buffer), "%g", containedValue);
+                out = buffer;
+            }
+            else if constexpr (std::is_same_v<Type, openassetio::Str>)
+            {
+                out = containedValue;
+            }
+            else
+            {
+                std::ostringstream sstr;
+                sstr << std::boolalpha << containedValue;
+                out = sstr.str();
+            }
+        },
+        value);
+}
 }  // namespace
 
-OpenAssetIOAsset::OpenAssetIOAsset()
+OpenAssetIOAsset::OpenAssetIOAsset() : OpenAssetIOAsset{&ManagerLoader::LoadDefaultManager} {}
+
+OpenAssetIOAsset::OpenAssetIOAsset(ManagerLoader::LoadFunction loadManagerFunction)
+    : _logger{std::make_shared<KatanaLoggerInterface>(
+          Environment::IsFlagSet(kAsyncLoggingEnvVar))},
+      _loadManagerFunction{std::move(loadManagerFunction)}
 {
+    // Read before the initial reset, which needn't load a manager if
+    // the daemon will answer.
+    _resolverSocketPath = Environment::GetString(Constants::kResolverSocketEnvVar);
+    if (const std::size_t deadlineMs = Environment::GetUnsigned(Constants::kDeadlineEnvVar, 0))
+    {
+        _staleWhileRevalidate = std::make_unique<StaleWhileRevalidate>(
+            std::chrono::milliseconds{deadlineMs},
+            Environment::GetUnsigned(Constants::kRefreshThreadsEnvVar,
+                                     Constants::kDefaultRefreshThreads));
+    }
+    const std::size_t maxInFlight = Environment::GetUnsigned(Constants::kMaxInFlightEnvVar, 0);
+    const std::size_t rateLimit = Environment::GetUnsigned(Constants::kRateLimitEnvVar, 0);
+    if (maxInFlight != 0 || rateLimit != 0)
+    {
+        _admissionController = std::make_unique<AdmissionController>(
+            maxInFlight,
+            static_cast<double>(rateLimit),
+            Environment::GetUnsigned(Constants::kRateBurstEnvVar, rateLimit));
+    }
+    if (const std::size_t budget = Environment::GetUnsigned(Constants::kPrefetchBudgetEnvVar, 0))
+    {
+        _prefetcher = std::make_unique<Prefetcher>(
+            budget,
+            [this](const CallLog::Method method, const StringVector& assetIds)
+            { prefetch(method, assetIds); },
+            [this](const CallLog::Method method, const std::string_view assetId)
+            { return isCached(method, assetId); });
+    }
+    if (const std::size_t budgetMegabytes =
+            Environment::GetUnsigned(Constants::kCacheBudgetEnvVar, 0))
+    {
+        // The URL memo only holds URLs that the fast path can't
+        // convert, so is typically far smaller than the entity cache.
+        const std::size_t budgetBytes = budgetMegabytes * 1024 * 1024;
+        _entityCache.setBudget(budgetBytes - budgetBytes / 8);
+        _fileUrlPathConverter.setBudget(budgetBytes / 8);
+    }
     OpenAssetIOAsset::reset();
+
+    // Connected after the initial reset, so that starting a process
+    // doesn't flush the daemon's cache for all of its peers.
+    if (_resolverSocketPath)
+    {
+        _resolverClient = std::make_unique<ResolverClient>(
+            *_resolverSocketPath,
+            std::chrono::milliseconds{Environment::GetUnsigned(
+                Constants::kResolverTimeoutEnvVar, Constants::kDefaultResolverTimeoutMs)});
+    }
+
+    // Likewise, so that starting a process doesn't invalidate entries
+    // published by its peers.
+    if (Environment::IsFlagSet(Constants::kSharedCacheEnvVar))
+    {
+        const std::size_t megabytes = Environment::GetUnsigned(
+            Constants::kSharedCacheSizeEnvVar, Constants::kDefaultSharedCacheMegabytes);
+        _sharedCache = SharedResolveCache::open(SharedResolveCache::defaultSegmentName(),
+                                                megabytes * 1024 * 1024);
+        if (!_sharedCache)
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  openassetio::log::LoggerInterface::Severity::kWarning,
+                                  "Shared resolve cache unavailable - caching per-process only");
+        }
+    }
+
+    // Likewise, so that the construction-time reset doesn't discard it.
+    if (const auto snapshotPath = Environment::GetString(Constants::kSnapshotEnvVar))
+    {
+        _snapshotPath = *snapshotPath;
+        _snapshot =
+            ResolveSnapshot::open(_snapshotPath, ManagerLoader::ConfigurationFingerprint());
+        if (_snapshot)
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  openassetio::log::LoggerInterface::Severity::kDebug,
+                                  "Loaded snapshot of " << _snapshot->size()
+                                                        << " resolved values");
+        }
+    }
+
+    // Likewise, so that the construction-time reset isn't recorded.
+    if (const auto recordPath = Environment::GetString(Constants::kRecordCallsEnvVar))
+    {
+        _recorder = CallRecorder::open(*recordPath);
+    }
+
+    const std::lock_guard lock{gInstancesMutex};
+    gInstances.push_back(this);
+}
+
+OpenAssetIOAsset::~OpenAssetIOAsset()
+{
+    {
+        const std::lock_guard lock{gInstancesMutex};
+        gInstances.erase(std::find(gInstances.begin(), gInstances.end(), this));
+    }
+    try
+    {
+        if (!_snapshotPath.empty() && !saveSnapshot())
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  openassetio::log::LoggerInterface::Severity::kWarning,
+                                  "Failed to save resolve snapshot to " << _snapshotPath);
+        }
+    }
+    catch (const std::exception& exc)
+    {
+        KATANAOPENASSETIO_LOG(*_logger,
+                              openassetio::log::LoggerInterface::Severity::kWarning,
+                              "Failed to save resolve snapshot: " << exc.what());
+    }
+}
+
+std::optional<StaleWhileRevalidate::Counters> OpenAssetIOAsset::staleWhileRevalidateCounters()
+    const
+{
+    if (!_staleWhileRevalidate)
+    {
+        return std::nullopt;
+    }
+    return _staleWhileRevalidate->counters();
+}
+
+std::optional<Prefetcher::Counters> OpenAssetIOAsset::prefetcherCounters() const
+{
+    if (!_prefetcher)
+    {
+        return std::nullopt;
+    }
+    return _prefetcher->counters();
+}
+
+std::string OpenAssetIOAsset::contextPersistenceToken()
+{
+    const SessionPtr session = this->session();
+    return session->manager->persistenceTokenForContext(session->context);
 }
 
-OpenAssetIOAsset::~OpenAssetIOAsset() = default;
+std::size_t OpenAssetIOAsset::memoryUsage() const
+{
+    return _entityCache.memoryUsage() + _fileUrlPathConverter.memoryUsage();
+}
+
+void OpenAssetIOAsset::flush()
+{
+    // Held throughout, so that instances can't be destroyed whilst
+    // being trimmed.
+    const std::lock_guard lock{gInstancesMutex};
+    for (OpenAssetIOAsset* instance : gInstances)
+    {
+        try
+        {
+            instance->trim();
+        }
+        catch (const std::exception& exc)
+        {
+            KATANAOPENASSETIO_LOG(*instance->_logger,
+                                  openassetio::log::LoggerInterface::Severity::kWarning,
+                                  "Failed to trim caches: " << exc.what());
+        }
+    }
+}
+
+void OpenAssetIOAsset::trim()
+{
+    const std::size_t usage = memoryUsage();
+    const std::size_t evicted = _entityCache.trim();
+    _fileUrlPathConverter.trim();
+    if (_prefetcher)
+    {
+        // Prefetched values may have just been evicted.
+        _prefetcher->reset();
+    }
+    KATANAOPENASSETIO_LOG(*_logger,
+                          openassetio::log::LoggerInterface::Severity::kDebug,
+                          "OpenAssetIOAsset: trimmed caches from "
+                              << usage << " to " << memoryUsage() << " bytes, evicting "
+                              << evicted << " values");
+
+    // The manager may hold much more (e.g. Python managers), which it
+    // can only be asked to discard wholesale.
+    const std::lock_guard lock{_managerMutex};
+    if (_session)
+    {
+        _session->manager->flushCaches();
+    }
+}
 
 void OpenAssetIOAsset::reset()
 {
-    using openassetio::hostApi::ManagerFactory;
-    using openassetio::hostApi::ManagerImplementationFactoryInterfacePtr;
-    using openassetio::pluginSystem::CppPluginSystemManagerImplementationFactory;
-    using openassetio::pluginSystem::HybridPluginSystemManagerImplementationFactory;
-    namespace pyApi = openassetio::python::hostApi;
+    const CallRecorder::Call call{_recorder.get(), CallLog::Method::kReset};
+
+    if (_recorder)
+    {
+        // A convenient point to bound how much is lost if we crash.
+        _recorder->flush();
+    }
+
+    KATANAOPENASSETIO_LOG(*_logger,
+                          openassetio::log::LoggerInterface::Severity::kDebug,
+                          "OpenAssetIOAsset: caches held " << memoryUsage() << " bytes");
+
+    // Katana is flushing its caches, so should we.
+    if (_snapshot)
+    {
+        // Before the cache, so that snapshot values looked up
+        // concurrently aren't cached afresh.
+        _snapshot->discard();
+    }
+    if (_staleWhileRevalidate)
+    {
+        // Retain values to serve if the manager is slow to respond,
+        // but only those refreshed since the last flush, so that the
+        // cache doesn't grow with every flush.
+        const std::size_t discarded = _entityCache.discardStale();
+        _entityCache.invalidate();
+
+        const StaleWhileRevalidate::Counters counters = _staleWhileRevalidate->counters();
+        KATANAOPENASSETIO_LOG(*_logger,
+                              openassetio::log::LoggerInterface::Severity::kDebug,
+                              "OpenAssetIOAsset: served " << counters.staleServes
+                                                          << " stale values, refreshed "
+                                                          << counters.refreshes << " ("
+                                                          << counters.refreshFailures
+                                                          << " failed) in the background, "
+                                                          << "discarded " << discarded
+                                                          << " not refreshed since");
+    }
+    else
+    {
+        _entityCache.clear();
+    }
+    if (_prefetcher)
+    {
+        // What was prefetched has just been discarded.
+        _prefetcher->reset();
+
+        const Prefetcher::Counters counters = _prefetcher->counters();
+        KATANAOPENASSETIO_LOG(*_logger,
+                              openassetio::log::LoggerInterface::Severity::kDebug,
+                              "OpenAssetIOAsset: prefetched "
+                                  << counters.prefetched << " values, of which " << counters.hits
+                                  << " were used (" << counters.lateHits << " more too late, "
+                                  << counters.wasted << " unused, " << counters.dropped
+                                  << " predictions over budget)");
+    }
+    _fileUrlPathConverter.clear();
+    if (_sharedCache)
+    {
+        // Entries are logically discarded for every process on the host.
+        _sharedCache->invalidate();
+    }
+
+    if (_resolverClient)
+    {
+        // Propagate the flush, so that subsequent lookups (from any
+        // process) see the latest state of the asset management system.
+        _resolverClient->flush();
+    }
+
+    const std::lock_guard lock{_managerMutex};
+    if (_session && ManagerLoader::ConfigurationFingerprint() == _managerFingerprint)
+    {
+        // Reconstructing the manager can take seconds (e.g. for Python
+        // managers), so if it would be configured the same, keep it and
+        // just discard its cached state.
+        _session->manager->flushCaches();
+        auto session = std::make_shared<Session>(*_session);
+        session->context = ManagerLoader::CreateContext(session->manager, _logger);
+        std::atomic_store(&_session, SessionPtr{std::move(session)});
+        return;
+    }
+
+    // Queries in flight keep the previous session alive until they
+    // complete.
+    std::atomic_store(&_session, SessionPtr{});
+    if (_resolverSocketPath)
+    {
+        // Many processes (e.g. renderboot) only ever resolve, in which
+        // case the daemon answers everything, and we need never pay
+        // the cost of loading a manager in this process.
+        return;
+    }
+    loadManager();
+}
 
+void OpenAssetIOAsset::loadManager()
+{
     try
     {
+        _managerFingerprint = ManagerLoader::ConfigurationFingerprint();
         _hostInterface = std::make_shared<KatanaHostInterface>();
-        const auto logger = std::make_shared<KatanaLoggerInterface>();
-
-        // Create the appropriate plugin system.
-        const auto managerImplFactory = [&]() -> ManagerImplementationFactoryInterfacePtr
+        auto session = std::make_shared<Session>();
+        session->manager = _loadManagerFunction(_hostInterface, _logger);
+        session->context = ManagerLoader::CreateContext(session->manager, _logger);
+
+        // Queried on every containsAssetId, and constant for the
+        // lifetime of the manager.
+        const auto info = session->manager->info();
+        if (const auto prefixIt =
+                info.find(openassetio::constants::kInfoKey_EntityReferencesMatchPrefix.data());
+            prefixIt != info.end())
         {
-            const char* disablePythonEnvVar = std::getenv(kDisablePythonEnvVar);
-            if (disablePythonEnvVar && std::string_view{disablePythonEnvVar} != "0")
+            if (const auto* prefix = std::get_if<openassetio::Str>(&prefixIt->second))
             {
-                // User has chosen to disable Python manager plugins. So
-                // just use the C++ plugin system.
-                return CppPluginSystemManagerImplementationFactory::make(logger);
+                session->entityReferencePrefix = *prefix;
             }
-            // Support  C++ or Python or hybrid C++/Python plugins.
-            return HybridPluginSystemManagerImplementationFactory::make(
-                {// Plugin systems:
-                 // C++ plugin system
-                 CppPluginSystemManagerImplementationFactory::make(logger),
-                 // Python plugin system
-                 pyApi::createPythonPluginSystemManagerImplementationFactory(logger)},
-                logger);
-        }();
-
-        _manager =
-            ManagerFactory::defaultManagerForInterface(_hostInterface, managerImplFactory, logger);
-
-        if (!_manager)
-        {
-            throw openassetio::errors::ConfigurationException{
-                "No default OpenAssetIO manager configured. Set OPENASSETIO_DEFAULT_CONFIG."};
         }
 
-        _context = _manager->createContext();
+        std::atomic_store(&_session, SessionPtr{std::move(session)});
     }
     catch (const std::exception& exc)
     {
-        FnLogError(exc.what());
+        _logger->log(openassetio::log::LoggerInterface::Severity::kError, exc.what());
         throw;
     }
 }
 
+OpenAssetIOAsset::SessionPtr OpenAssetIOAsset::session()
+{
+    if (SessionPtr session = std::atomic_load(&_session))
+    {
+        return session;
+    }
+    const std::lock_guard lock{_managerMutex};
+    if (!_session)
+    {
+        loadManager();
+    }
+    return _session;
+}
+
+const std::string* OpenAssetIOAsset::daemonEntityReferencePrefix()
+{
+    if (!_resolverClient)
+    {
+        return nullptr;
+    }
+    if (!_daemonPrefixQueried.load(std::memory_order_acquire))
+    {
+        const std::lock_guard lock{_daemonPrefixMutex};
+        if (!_daemonPrefixQueried.load(std::memory_order_relaxed))
+        {
+            if (!_resolverClient->entityReferencePrefix(_daemonPrefix))
+            {
+                // Try again once the daemon is back.
+                return nullptr;
+            }
+            _daemonPrefixQueried.store(true, std::memory_order_release);
+        }
+    }
+    return _daemonPrefix ? &*_daemonPrefix : nullptr;
+}
+
+AdmissionController::Ticket OpenAssetIOAsset::admit(const AdmissionController::Priority priority)
+{
+    if (!_admissionController)
+    {
+        return {};
+    }
+    return _admissionController->admit(priority);
+}
+
 std::optional<openassetio::EntityReference> OpenAssetIOAsset::entityRefForAssetIdAndVersion(
+    const Session& session,
     const std::string& assetId,
     const std::string& desiredVersionTag)
 {
@@ -153,13 +781,15 @@ std::optional<openassetio::EntityReference> OpenAssetIOAsset::entityRefForAssetI
     using openassetio::EntityReference;
     using openassetio::access::RelationsAccess;
     using openassetio::access::ResolveAccess;
+    using openassetio::log::LoggerInterface;
     using openassetio_mediacreation::specifications::lifecycle::
         EntityVersionsRelationshipSpecification;
     using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+    using Severity = LoggerInterface::Severity;
 
     // Validate the asset ID and get a strongly typed wrapper for
     // subsequent queries.
-    const EntityReference sourceEntityRef = _manager->createEntityReference(assetId);
+    const EntityReference sourceEntityRef = session.manager->createEntityReference(assetId);
 
     // Relationship to get references to different versions of
     // the same logical entity.
@@ -172,223 +802,1396 @@ std::optional<openassetio::EntityReference> OpenAssetIOAsset::entityRefForAssetI
     constexpr std::size_t kNumExpectedResults = 1;
 
     // Get references that point to the given version of the asset.
-    const auto versionsPager = _manager->getWithRelationship(sourceEntityRef,
-                                                             relationship.traitsData(),
-                                                             kNumExpectedResults,
-                                                             RelationsAccess::kRead,
-                                                             _context,
-                                                             {});
+    const auto versionsPager = session.manager->getWithRelationship(sourceEntityRef,
+                                                                   relationship.traitsData(),
+                                                                   kNumExpectedResults,
+                                                                   RelationsAccess::kRead,
+                                                                   session.context,
+                                                                   {});
     if (versionsPager->hasNext())
     {
-        FnLogDebug("OpenAssetIOAsset: more than one result querying specific version for asset '"
-                   << assetId << "' and version '" << desiredVersionTag
-                   << "' - ignoring remainder");
+        KATANAOPENASSETIO_LOG(
+            *_logger,
+            Severity::kDebug,
+            "OpenAssetIOAsset: more than one result querying specific version for asset '"
+                << assetId << "' and version '" << desiredVersionTag
+                << "' - ignoring remainder");
     }
 
     // Get first page of references, which should have a page size of 1,
     // i.e. a single-element array.
-    const auto versionedRefs = versionsPager->get();
+    auto versionedRefs = versionsPager->get();
 
     if (versionedRefs.empty())
     {
-        FnLogDebug("OpenAssetIOAsset: no results querying specific version for asset '"
-                   << assetId << "' and version '" << desiredVersionTag << "'");
+        KATANAOPENASSETIO_LOG(*_logger,
+                              Severity::kDebug,
+                              "OpenAssetIOAsset: no results querying specific version for asset '"
+                                  << assetId << "' and version '" << desiredVersionTag << "'");
         return std::nullopt;
     }
 
     // Return the matching reference.
-    return versionedRefs.front();
+    return std::move(versionedRefs.front());
 }
 
-bool OpenAssetIOAsset::isAssetId(const std::string& name)
+bool OpenAssetIOAsset::resolveLocationFromManager(const Session& session,
+                                                  const AdmissionController::Priority priority,
+                                                  const std::string& assetId,
+                                                  std::string& location)
 {
-    const auto result = _manager->isEntityReferenceString(name);
-    return result;
-}
+    using openassetio::access::ResolveAccess;
+    using openassetio_mediacreation::traits::content::LocatableContentTrait;
 
-bool OpenAssetIOAsset::containsAssetId(const std::string& id)
-{
-    using namespace openassetio::constants;
-    const auto info = _manager->info();
-    const auto prefixKey = info.find(kInfoKey_EntityReferencesMatchPrefix.data());
-    if (prefixKey == info.end())
+    const auto ticket = admit(priority);
+
+    // We don't know anything else about the asset other than its ID at this
+    // point so attempt to resolve given only the LocatableContentTrait.
+    const auto entityReference = session.manager->createEntityReference(assetId);
+    const auto traitData = session.manager->resolve(entityReference,
+                                                    Queries::CacheableLocationTraits(),
+                                                    ResolveAccess::kRead,
+                                                    session.context);
+    const auto url = LocatableContentTrait(traitData).getLocation();
+
+    if (!url)
     {
-        throw std::runtime_error("OpenAssetIO does not provide entity reference prefix.");
+        throw std::runtime_error{assetId + " has no location"};
     }
+    _fileUrlPathConverter.pathFromUrl(*url, location);
+    return isStableVersion(traitData);
+}
+
+void OpenAssetIOAsset::resolveFieldsFromManager(const Session& session,
+                                                const AdmissionController::Priority priority,
+                                                const std::string& assetId,
+                                                std::string& displayName,
+                                                std::string& versionTag)
+{
+    using openassetio::access::ResolveAccess;
+    using openassetio_mediacreation::traits::identity::DisplayNameTrait;
+    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
 
-    const auto prefix = std::get<std::string>(prefixKey->second);
-    return id.find(prefix) != std::string::npos;
+    const auto ticket = admit(priority);
+    const auto entityReference = session.manager->createEntityReference(assetId);
+
+    const auto traitsData = session.manager->resolve(
+        entityReference, Queries::FieldTraits(), ResolveAccess::kRead, session.context);
+
+    displayName = DisplayNameTrait{traitsData}.getName("");
+    versionTag = VersionTrait{traitsData}.getSpecifiedTag("");
 }
 
-bool OpenAssetIOAsset::checkPermissions(const std::string& assetId, const StringMap& context)
+AdmissionController::Priority OpenAssetIOAsset::refreshPriority(
+    const std::chrono::steady_clock::time_point deadline)
 {
-    // TODO: Implement checkPermissions()
+    return std::chrono::steady_clock::now() < deadline
+               ? AdmissionController::Priority::kInteractive
+               : AdmissionController::Priority::kBackground;
+}
+
+void OpenAssetIOAsset::observe(const CallLog::Method method, const std::string& assetId)
+{
+    if (_prefetcher)
+    {
+        _prefetcher->observe(method, assetId);
+    }
+}
+
+void OpenAssetIOAsset::prefetch(const CallLog::Method method, const StringVector& assetIds)
+{
+    using Column = AssetTable::Column;
+    using Field = EntityCache::Field;
+
+    AssetTable table;
+    switch (method)
+    {
+        case CallLog::Method::kResolveAsset:
+            if (_resolverClient)
+            {
+                Scratch& scratch = threadScratch();
+                scratch.assetIds.assign(assetIds.begin(), assetIds.end());
+                // Before the request, so that results that pre-date a
+                // concurrent reset aren't cached.
+                const EntityCache::Generation generation = _entityCache.generation();
+                if (_resolverClient->resolveLocations(scratch.assetIds, scratch.results))
+                {
+                    for (std::size_t idx = 0; idx < assetIds.size(); ++idx)
+                    {
+                        const ResolverProtocol::Result& result = scratch.results[idx];
+                        // Only prefetched to be cached, so volatile
+                        // results are of no use.
+                        if (result.status == ResolverProtocol::Status::kOk)
+                        {
+                            _entityCache.put(
+                                assetIds[idx], Field::kLocation, result.value, generation);
+                        }
+                    }
+                    return;
+                }
+            }
+            getAssetTable(assetIds, {Column::kLocation}, table);
+            return;
+        case CallLog::Method::kResolveAssetVersion:
+            getAssetTable(assetIds, {Column::kResolvedVersion}, table);
+            return;
+        case CallLog::Method::kGetAssetDisplayName:
+            getAssetTable(assetIds, {Column::kName}, table);
+            return;
+        case CallLog::Method::kGetAssetFields:
+            getAssetTable(assetIds, {Column::kName, Column::kVersion}, table);
+            return;
+        case CallLog::Method::kGetAssetVersions:
+        {
+            std::vector<StringVector> versions;
+            getAssetVersionsBulk(assetIds, versions);
+            return;
+        }
+        default:
+            return;
+    }
+}
+
+bool OpenAssetIOAsset::isCached(const CallLog::Method method, const std::string_view assetId)
+{
+    using Field = EntityCache::Field;
+
+    // Reused, since called for every prediction.
+    thread_local std::string assetIdScratch;
+    thread_local std::string value;
+    assetIdScratch.assign(assetId);
+
+    switch (method)
+    {
+        case CallLog::Method::kResolveAsset:
+            return getCached(assetIdScratch, Field::kLocation, value) ||
+                   (_sharedCache && _sharedCache->get(assetIdScratch, value));
+        case CallLog::Method::kResolveAssetVersion:
+            return getCached(assetIdScratch, Field::kStableVersionTag, value);
+        case CallLog::Method::kGetAssetDisplayName:
+            return getCached(assetIdScratch, Field::kDisplayName, value);
+        case CallLog::Method::kGetAssetFields:
+            return getCached(assetIdScratch, Field::kDisplayName, value) &&
+                   getCached(assetIdScratch, Field::kVersionTag, value);
+        case CallLog::Method::kGetAssetVersions:
+            return getCached(assetIdScratch, Field::kVersions, value);
+        default:
+            return true;
+    }
+}
+
+bool OpenAssetIOAsset::getCached(const std::string& assetId,
+                                 const EntityCache::Field field,
+                                 std::string& out)
+{
+    if (_entityCache.get(assetId, field, out))
+    {
+        return true;
+    }
+    if (!_snapshot || (_staleWhileRevalidate && isRevalidated(field)))
+    {
+        return false;
+    }
+    // Before the lookup, so as not to cache the value if the snapshot
+    // is discarded meanwhile.
+    const EntityCache::Generation generation = _entityCache.generation();
+    if (!_snapshot->get(assetId, field, out))
+    {
+        return false;
+    }
+    _entityCache.put(assetId, field, out, generation);
+    return true;
+}
+
+bool OpenAssetIOAsset::getStale(const std::string& assetId,
+                                const EntityCache::Field field,
+                                std::string& out)
+{
+    return _entityCache.getStale(assetId, field, out) ||
+           (_snapshot && _snapshot->get(assetId, field, out));
+}
+
+void OpenAssetIOAsset::invalidatePublished(const std::vector<std::string>& assetIds)
+{
+    if (_snapshot)
+    {
+        // Can't be invalidated selectively, and predates the publish.
+        _snapshot->discard();
+    }
+    for (const std::string& assetId : assetIds)
+    {
+        _entityCache.invalidate(assetId);
+        if (_sharedCache)
+        {
+            _sharedCache->erase(assetId);
+        }
+    }
+    _entityCache.invalidate(EntityCache::Field::kVersions);
+    _entityCache.invalidate(EntityCache::Field::kVersionedAssetId);
+}
+
+bool OpenAssetIOAsset::saveSnapshot()
+{
+    if (_snapshotPath.empty())
+    {
+        return false;
+    }
+    return ResolveSnapshot::save(
+        _snapshotPath, ManagerLoader::ConfigurationFingerprint(), _entityCache, _snapshot.get());
+}
+
+openassetio::trait::TraitSet OpenAssetIOAsset::cachedEntityTraits(
+    const Session& session,
+    const std::string& assetId,
+    const openassetio::EntityReference& entityReference)
+{
+    using openassetio::access::EntityTraitsAccess;
+
+    openassetio::trait::TraitSet traitSet;
+    std::string encoded;
+    if (getCached(assetId, EntityCache::Field::kEntityTraits, encoded))
+    {
+        for (std::string_view remaining{encoded}; !remaining.empty();)
+        {
+            const auto sep = remaining.find('\n');
+            traitSet.emplace(remaining.substr(0, sep));
+            remaining.remove_prefix(sep == std::string_view::npos ? remaining.size() : sep + 1);
+        }
+        return traitSet;
+    }
+
+    traitSet =
+        session.manager->entityTraits(entityReference, EntityTraitsAccess::kRead, session.context);
+    for (const auto& traitId : traitSet)
+    {
+        if (!encoded.empty())
+        {
+            encoded += '\n';
+        }
+        encoded += traitId;
+    }
+    _entityCache.put(assetId, EntityCache::Field::kEntityTraits, encoded);
+    return traitSet;
+}
+
+bool OpenAssetIOAsset::isAssetId(const std::string& name)
+{
+    const CallRecorder::Call call{_recorder.get(), CallLog::Method::kIsAssetId, name};
+
+    if (const std::string* prefix = daemonEntityReferencePrefix())
+    {
+        // As the manager would, given a prefix.
+        return name.rfind(*prefix, 0) == 0;
+    }
+    const auto result = session()->manager->isEntityReferenceString(name);
+    return result;
+}
+
+bool OpenAssetIOAsset::containsAssetId(const std::string& id)
+{
+    const CallRecorder::Call call{_recorder.get(), CallLog::Method::kContainsAssetId, id};
+
+    if (const std::string* prefix = daemonEntityReferencePrefix())
+    {
+        return id.find(*prefix) != std::string::npos;
+    }
+    const SessionPtr session = this->session();
+    if (!session->entityReferencePrefix)
+    {
+        throw std::runtime_error("OpenAssetIO does not provide entity reference prefix.");
+    }
+    return id.find(*session->entityReferencePrefix) != std::string::npos;
+}
+
+bool OpenAssetIOAsset::checkPermissions(const std::string& assetId, const StringMap& context)
+{
+    const CallRecorder::Call call{
+        _recorder.get(), CallLog::Method::kCheckPermissions, assetId, context};
+
+    // TODO: Implement checkPermissions()
     (void)assetId;
     (void)context;
     return true;
 }
 
-bool OpenAssetIOAsset::runAssetPluginCommand(const std::string& assetId,
-                                             const std::string& command,
-                                             const StringMap& commandArgs)
+bool OpenAssetIOAsset::runAssetPluginCommand(const std::string& assetId,
+                                             const std::string& command,
+                                             const StringMap& commandArgs)
+{
+    const CallRecorder::Call call{
+        _recorder.get(), CallLog::Method::kRunAssetPluginCommand, assetId, command, commandArgs};
+
+    if (command == kGetAssetVersionsCommand)
+    {
+        // Lists the versions of many assets with a single query, so
+        // that subsequent getAssetVersions calls for them are answered
+        // from the cache.
+        StringVector assetIds;
+        if (const auto assetIdsIt = commandArgs.find(kAssetIdsCommandArg);
+            assetIdsIt != commandArgs.end())
+        {
+            splitLines(assetIdsIt->second, assetIds);
+        }
+        if (!assetId.empty())
+        {
+            assetIds.push_back(assetId);
+        }
+        std::vector<StringVector> versions;
+        return getAssetVersionsBulk(assetIds, versions);
+    }
+    if (command == kBuildAssetIdsCommand)
+    {
+        // Resolves the given versions of many assets with a query per
+        // distinct version, so that subsequent buildAssetId calls for
+        // them, e.g. when updating all assets to "latest", are answered
+        // from the cache.
+        StringVector assetIds;
+        StringVector versionTags;
+        if (const auto assetIdsIt = commandArgs.find(kAssetIdsCommandArg);
+            assetIdsIt != commandArgs.end())
+        {
+            splitLines(assetIdsIt->second, assetIds);
+        }
+        if (!assetId.empty())
+        {
+            assetIds.push_back(assetId);
+        }
+        if (const auto versionsIt = commandArgs.find(kVersionsCommandArg);
+            versionsIt != commandArgs.end())
+        {
+            splitLines(versionsIt->second, versionTags);
+        }
+        if (versionTags.size() != 1 && versionTags.size() != assetIds.size())
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  openassetio::log::LoggerInterface::Severity::kWarning,
+                                  "buildAssetIds: expected one version, or one per asset, but got "
+                                      << versionTags.size() << " for " << assetIds.size()
+                                      << " assets");
+            return false;
+        }
+
+        std::vector<AssetVersion> assetVersions;
+        assetVersions.reserve(assetIds.size());
+        for (std::size_t idx = 0; idx < assetIds.size(); ++idx)
+        {
+            assetVersions.emplace_back(std::move(assetIds[idx]),
+                                       versionTags[versionTags.size() == 1 ? 0 : idx]);
+        }
+        StringVector versionedAssetIds;
+        return getVersionedAssetIdsBulk(assetVersions, versionedAssetIds);
+    }
+    if (command == kGetAssetTableCommand)
+    {
+        // Fills the cache with the given metadata of many assets with a
+        // single query, so that subsequent getAssetFields,
+        // getAssetDisplayName and resolveAsset calls for them are
+        // answered from the cache, e.g. when filling a table.
+        StringVector assetIds;
+        if (const auto assetIdsIt = commandArgs.find(kAssetIdsCommandArg);
+            assetIdsIt != commandArgs.end())
+        {
+            splitLines(assetIdsIt->second, assetIds);
+        }
+        if (!assetId.empty())
+        {
+            assetIds.push_back(assetId);
+        }
+        std::vector<AssetTable::Column> columns;
+        if (const auto columnsIt = commandArgs.find(kColumnsCommandArg);
+            columnsIt != commandArgs.end())
+        {
+            for (std::string_view remaining{columnsIt->second}; !remaining.empty();)
+            {
+                const auto sep = remaining.find(kColumnSep);
+                if (const auto name = remaining.substr(0, sep); !name.empty())
+                {
+                    const auto column = AssetTable::ParseColumn(name);
+                    if (!column)
+                    {
+                        KATANAOPENASSETIO_LOG(*_logger,
+                                              openassetio::log::LoggerInterface::Severity::kWarning,
+                                              "getAssetTable: unknown column '" << name << "'");
+                        return false;
+                    }
+                    columns.push_back(*column);
+                }
+                remaining.remove_prefix(sep == std::string_view::npos ? remaining.size()
+                                                                       : sep + 1);
+            }
+        }
+        AssetTable table;
+        return getAssetTable(assetIds, std::move(columns), table);
+    }
+    if (command == kValidateCommand)
+    {
+        // Checks that every asset exists and resolves to files on disk,
+        // e.g. before submitting the scene to a render farm.
+        StringVector assetIds;
+        if (const auto assetIdsIt = commandArgs.find(kAssetIdsCommandArg);
+            assetIdsIt != commandArgs.end())
+        {
+            splitLines(assetIdsIt->second, assetIds);
+        }
+        if (!assetId.empty())
+        {
+            assetIds.push_back(assetId);
+        }
+        std::vector<Validation> validations;
+        const bool valid = validateAssets(assetIds, validations);
+        if (const auto reportIt = commandArgs.find(kReportCommandArg);
+            reportIt != commandArgs.end() &&
+            !writeValidationReport(reportIt->second, assetIds, validations))
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  openassetio::log::LoggerInterface::Severity::kWarning,
+                                  "validate: failed to write report to " << reportIt->second);
+            return false;
+        }
+        return valid;
+    }
+    if (command == kSaveSnapshotCommand)
+    {
+        return saveSnapshot();
+    }
+    if (command == kExportContextTokenCommand)
+    {
+        // So that child processes (e.g. renderboot) restore this
+        // session, rather than each setting up their own. Not via our
+        // own environment, since setting it would race with threads
+        // reading it.
+        const auto pathIt = commandArgs.find(kPathCommandArg);
+        if (pathIt == commandArgs.end() || pathIt->second.empty())
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  openassetio::log::LoggerInterface::Severity::kWarning,
+                                  "exportContextToken: no \"" << kPathCommandArg << "\" given");
+            return false;
+        }
+        try
+        {
+            return writeContextToken(pathIt->second, contextPersistenceToken());
+        }
+        catch (const std::exception& exc)
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  openassetio::log::LoggerInterface::Severity::kWarning,
+                                  "exportContextToken: " << exc.what());
+            return false;
+        }
+    }
+    if (command == kTrimCommand)
+    {
+        trim();
+        return true;
+    }
+
+    // TODO: Implement other commands.
+    return true;
+}
+
+void OpenAssetIOAsset::resolveAsset(const std::string& assetId, std::string& resolvedAsset)
+{
+    const CallRecorder::Call call{_recorder.get(), CallLog::Method::kResolveAsset, assetId};
+    observe(CallLog::Method::kResolveAsset, assetId);
+
+    if (getCached(assetId, EntityCache::Field::kLocation, resolvedAsset))
+    {
+        return;
+    }
+
+    if (_sharedCache && _sharedCache->get(assetId, resolvedAsset))
+    {
+        _entityCache.put(assetId, EntityCache::Field::kLocation, resolvedAsset);
+        return;
+    }
+
+    if (_resolverClient)
+    {
+        Scratch& scratch = threadScratch();
+        scratch.assetIds.assign(1, assetId);
+        if (_resolverClient->resolveLocations(scratch.assetIds, scratch.results))
+        {
+            const ResolverProtocol::Result& result = scratch.results.front();
+            if (result.status == ResolverProtocol::Status::kError)
+            {
+                throw std::runtime_error{result.value};
+            }
+            // Copy, rather than move, to keep the scratch capacity.
+            resolvedAsset.assign(result.value);
+            if (result.status == ResolverProtocol::Status::kOk)
+            {
+                _entityCache.put(assetId, EntityCache::Field::kLocation, resolvedAsset);
+                if (_sharedCache)
+                {
+                    _sharedCache->put(assetId, resolvedAsset);
+                }
+            }
+            return;
+        }
+        KATANAOPENASSETIO_LOG(*_logger,
+                              openassetio::log::LoggerInterface::Severity::kWarning,
+                              "Resolver daemon unavailable at '"
+                                  << _resolverClient->socketPath()
+                                  << "' - falling back to in-process manager");
+    }
+
+    if (_staleWhileRevalidate)
+    {
+        // Any value cached before the last reset may be served if the
+        // manager misses the deadline.
+        const EntityCache::Generation generation = _entityCache.generation();
+        const bool haveStale = getStale(assetId, EntityCache::Field::kLocation, resolvedAsset);
+        // Captured now, so a reset before the refresh runs cannot
+        // change the manager or context it queries.
+        const auto deadline =
+            std::chrono::steady_clock::now() + _staleWhileRevalidate->deadline();
+        auto values = _staleWhileRevalidate->fetch(
+            "resolveAsset:" + assetId,
+            [this, assetId, generation, session = session(), deadline]
+            {
+                std::string location;
+                if (resolveLocationFromManager(
+                        *session, refreshPriority(deadline), assetId, location) &&
+                    _entityCache.put(
+                        assetId, EntityCache::Field::kLocation, location, generation) &&
+                    _sharedCache)
+                {
+                    _sharedCache->put(assetId, location);
+                }
+                return StaleWhileRevalidate::Values{std::move(location)};
+            },
+            haveStale);
+        if (values)
+        {
+            resolvedAsset = std::move(values->front());
+        }
+        return;
+    }
+
+    // Only a specific version's location is cached, as a
+    // meta-version's changes when another version is published.
+    if (!resolveLocationFromManager(
+            *session(), AdmissionController::Priority::kInteractive, assetId, resolvedAsset))
+    {
+        return;
+    }
+    _entityCache.put(assetId, EntityCache::Field::kLocation, resolvedAsset);
+    if (_sharedCache)
+    {
+        _sharedCache->put(assetId, resolvedAsset);
+    }
+}
+
+void OpenAssetIOAsset::resolveAllAssets(const std::string& id, std::string& assets)
+{
+    const CallRecorder::Call call{_recorder.get(), CallLog::Method::kResolveAllAssets, id};
+
+    // TODO: Implement resolveAllAssets() - I don't understand this function
+    resolveAsset(id, assets);
+}
+
+void OpenAssetIOAsset::resolvePath(const std::string& str, const int frame, std::string& ret)
+{
+    const CallRecorder::Call call{_recorder.get(), CallLog::Method::kResolvePath, str, frame};
+
+    resolveAsset(str, ret);
+
+    if (FnKat::DefaultFileSequencePlugin::isFileSequence(ret))
+    {
+        ret = FnKat::DefaultFileSequencePlugin::resolveFileSequence(ret, frame);
+    }
+}
+
+void OpenAssetIOAsset::resolveAssetVersion(const std::string& assetId,
+                                           std::string& ret,
+                                           const std::string& versionStr)
+{
+    const CallRecorder::Call call{
+        _recorder.get(), CallLog::Method::kResolveAssetVersion, assetId, versionStr};
+
+    using openassetio::EntityReference;
+    using openassetio::access::ResolveAccess;
+    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+
+    // Only the asset's own version is cached, and only if it is a
+    // specific version (see below).
+    if (versionStr.empty())
+    {
+        observe(CallLog::Method::kResolveAssetVersion, assetId);
+        if (getCached(assetId, EntityCache::Field::kStableVersionTag, ret))
+        {
+            return;
+        }
+    }
+
+    const auto ticket = admit(AdmissionController::Priority::kInteractive);
+    const SessionPtr session = this->session();
+    const EntityReference entityReference = [&]
+    {
+        if (versionStr.empty())
+        {
+            // No alternate version, so we want to query the version
+            // tag associated with the given entity.
+            return session->manager->createEntityReference(assetId);
+        }
+
+        // Alternate version given, so we need to query the version tag
+        // associated with the entity corresponding to the given
+        // (meta-)version. E.g. "myasset://pony" with version of
+        // "latest" has an entity reference of "myasset://pony?v=latest"
+        // which we will `resolve` below to "v2" (assuming v2 is the
+        // latest version).
+        auto maybeEntityReference = entityRefForAssetIdAndVersion(*session, assetId, versionStr);
+
+        if (!maybeEntityReference)
+        {
+            throw std::runtime_error{"No version found for asset " + assetId + " and version " +
+                                     versionStr};
+        }
+        return std::move(*maybeEntityReference);
+    }();
+
+    // We don't have any other information about the asset other than its EntityReference so
+    // request the VersionTrait.
+    const auto traitData = session->manager->resolve(
+        entityReference, Queries::VersionTraits(), ResolveAccess::kRead, session->context);
+
+    // Usage by the Importomatic node implies "stableTag" is what we
+    // want here - its parameters panel has a column for "Version" and a
+    // column for "Resolved Version" where "Resolved Version" comes from
+    // this function (and "Version" comes from getAssetFields).
+    ret = VersionTrait{traitData}.getStableTag("");
+    // Not if a meta-version, which may be re-pointed whilst cached.
+    if (versionStr.empty() && isStableVersion(traitData))
+    {
+        _entityCache.put(assetId, EntityCache::Field::kStableVersionTag, ret);
+    }
+}
+
+void OpenAssetIOAsset::getAssetDisplayName(const std::string& assetId, std::string& ret)
+{
+    const CallRecorder::Call call{_recorder.get(), CallLog::Method::kGetAssetDisplayName, assetId};
+    observe(CallLog::Method::kGetAssetDisplayName, assetId);
+
+    using openassetio::access::ResolveAccess;
+    using openassetio_mediacreation::traits::identity::DisplayNameTrait;
+
+    // E.g. from getAssetFields, or an earlier bulk query.
+    if (getCached(assetId, EntityCache::Field::kDisplayName, ret))
+    {
+        return;
+    }
+
+    const auto ticket = admit(AdmissionController::Priority::kInteractive);
+    const SessionPtr session = this->session();
+    const auto entityReference = session->manager->createEntityReference(assetId);
+    const auto traitData = session->manager->resolve(
+        entityReference, Queries::DisplayNameTraits(), ResolveAccess::kRead, session->context);
+
+    ret = DisplayNameTrait{traitData}.getName("");
+    _entityCache.put(assetId, EntityCache::Field::kDisplayName, ret);
+}
+
+void OpenAssetIOAsset::getAssetVersions(const std::string& assetId, StringVector& ret)
+{
+    const CallRecorder::Call call{_recorder.get(), CallLog::Method::kGetAssetVersions, assetId};
+    observe(CallLog::Method::kGetAssetVersions, assetId);
+
+    using openassetio::access::RelationsAccess;
+    using openassetio::access::ResolveAccess;
+    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+
+    // E.g. from an earlier bulk query.
+    std::string encoded;
+    if (getCached(assetId, EntityCache::Field::kVersions, encoded))
+    {
+        decodeVersions(encoded, ret);
+        return;
+    }
+
+    const auto ticket = admit(AdmissionController::Priority::kBackground);
+
+    // Get all related references, such that each reference points to a
+    // different version of the same asset.
+    const SessionPtr session = this->session();
+    auto entityRefPager =
+        session->manager->getWithRelationship(session->manager->createEntityReference(assetId),
+                                              Queries::AllVersionsRelationship(),
+                                              Constants::kPageSize,
+                                              RelationsAccess::kRead,
+                                              session->context,
+                                              {});
+
+    // Collect all pages of related references into a single list. The
+    // first (and usually only) page is taken as-is.
+    openassetio::EntityReferences entityRefs = entityRefPager->get();
+    if (!entityRefs.empty())
+    {
+        entityRefPager->next();
+        openassetio::EntityReferences entityRefPage;
+        while (!(entityRefPage = entityRefPager->get()).empty())
+        {
+            std::move(begin(entityRefPage), end(entityRefPage), back_inserter(entityRefs));
+            entityRefPager->next();
+        }
+    }
+
+    // Batch `resolve` to get version metadata associated with each
+    // entity reference.
+    const auto traitsDatas = session->manager->resolve(
+        entityRefs, Queries::VersionTraits(), ResolveAccess::kRead, session->context);
+
+    // Extract and return the version "specified tag", i.e. version tag
+    // potentially including meta-versions such as "latest".
+    const std::size_t firstVersionIdx = ret.size();
+    ret.reserve(ret.size() + traitsDatas.size());
+    transform(cbegin(traitsDatas),
+              cend(traitsDatas),
+              back_inserter(ret),
+              [](const auto& traitsData) { return VersionTrait{traitsData}.getSpecifiedTag(""); });
+
+    encodeVersions(ret.begin() + static_cast<std::ptrdiff_t>(firstVersionIdx), ret.end(), encoded);
+    _entityCache.put(assetId, EntityCache::Field::kVersions, encoded);
+}
+
+bool OpenAssetIOAsset::getAssetVersionsBulk(const StringVector& assetIds,
+                                            std::vector<StringVector>& ret)
+{
+    using openassetio::EntityReferences;
+    using openassetio::access::RelationsAccess;
+    using openassetio::access::ResolveAccess;
+    using openassetio::errors::BatchElementError;
+    using openassetio::hostApi::EntityReferencePagerPtr;
+    using openassetio::log::LoggerInterface;
+    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+
+    ret.clear();
+    ret.resize(assetIds.size());
+
+    const auto ticket = admit(AdmissionController::Priority::kBackground);
+
+    // Serve what we can from the cache, and query the rest together.
+    // Indices into `assetIds` of the assets queried.
+    std::vector<std::size_t> queryIndices;
+    EntityReferences queryRefs;
+    std::vector<bool> failed(assetIds.size(), false);
+    std::string encoded;
+    // Only taken (loading the manager if need be) if something isn't
+    // cached, then used for every query.
+    SessionPtr session;
+    for (std::size_t idx = 0; idx < assetIds.size(); ++idx)
+    {
+        if (getCached(assetIds[idx], EntityCache::Field::kVersions, encoded))
+        {
+            decodeVersions(encoded, ret[idx]);
+            continue;
+        }
+        if (!session)
+        {
+            session = this->session();
+        }
+        auto entityRef = session->manager->createEntityReferenceIfValid(assetIds[idx]);
+        if (!entityRef)
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  LoggerInterface::Severity::kWarning,
+                                  "OpenAssetIOAsset: '" << assetIds[idx]
+                                                        << "' is not a valid asset ID");
+            failed[idx] = true;
+            continue;
+        }
+        queryIndices.push_back(idx);
+        queryRefs.push_back(std::move(*entityRef));
+    }
+    if (queryRefs.empty())
+    {
+        return std::find(failed.begin(), failed.end(), true) == failed.end();
+    }
+
+    const auto fail = [&](const std::size_t idx, const BatchElementError& error)
+    {
+        if (!failed[idx])
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  LoggerInterface::Severity::kWarning,
+                                  "OpenAssetIOAsset: failed to list versions of '"
+                                      << assetIds[idx] << "': " << error.message);
+        }
+        failed[idx] = true;
+    };
+
+    // A single relationship query for the versions of every asset.
+    std::vector<EntityReferencePagerPtr> pagers(queryRefs.size());
+    session->manager->getWithRelationship(
+        queryRefs,
+        Queries::AllVersionsRelationship(),
+        Constants::kPageSize,
+        RelationsAccess::kRead,
+        session->context,
+        [&pagers](const std::size_t queryIdx, EntityReferencePagerPtr pager)
+        { pagers[queryIdx] = std::move(pager); },
+        [&](const std::size_t queryIdx, const BatchElementError& error)
+        { fail(queryIndices[queryIdx], error); });
+
+    // Gather every version of every asset, noting where each result
+    // belongs. Only assets with more than a page of versions need
+    // further queries.
+    EntityReferences versionRefs;
+    // (index into `ret`, index within that asset's versions).
+    std::vector<std::pair<std::size_t, std::size_t>> versionSlots;
+    for (std::size_t queryIdx = 0; queryIdx < pagers.size(); ++queryIdx)
+    {
+        if (!pagers[queryIdx])
+        {
+            continue;
+        }
+        const std::size_t assetIdx = queryIndices[queryIdx];
+        for (EntityReferences page; !(page = pagers[queryIdx]->get()).empty();
+             pagers[queryIdx]->next())
+        {
+            for (auto& versionRef : page)
+            {
+                versionSlots.emplace_back(assetIdx, ret[assetIdx].size());
+                ret[assetIdx].emplace_back();
+                versionRefs.push_back(std::move(versionRef));
+            }
+        }
+    }
+
+    // A single resolve for the tags of all versions of all assets.
+    if (!versionRefs.empty())
+    {
+        session->manager->resolve(
+            versionRefs,
+            Queries::VersionTraits(),
+            ResolveAccess::kRead,
+            session->context,
+            [&](const std::size_t versionIdx, const openassetio::trait::TraitsDataPtr& traitsData)
+            {
+                const auto& [assetIdx, slotIdx] = versionSlots[versionIdx];
+                ret[assetIdx][slotIdx] = VersionTrait{traitsData}.getSpecifiedTag("");
+            },
+            [&](const std::size_t versionIdx, const BatchElementError& error)
+            { fail(versionSlots[versionIdx].first, error); });
+    }
+
+    bool succeeded = true;
+    for (std::size_t idx = 0; idx < assetIds.size(); ++idx)
+    {
+        if (failed[idx])
+        {
+            ret[idx].clear();
+            succeeded = false;
+        }
+    }
+    for (const std::size_t assetIdx : queryIndices)
+    {
+        if (!failed[assetIdx])
+        {
+            encodeVersions(ret[assetIdx].begin(), ret[assetIdx].end(), encoded);
+            _entityCache.put(assetIds[assetIdx], EntityCache::Field::kVersions, encoded);
+        }
+    }
+    return succeeded;
+}
+
+bool OpenAssetIOAsset::getVersionedAssetIdsBulk(const std::vector<AssetVersion>& assetVersions,
+                                                StringVector& ret)
 {
-    // TODO: Implement runAssetPluginCommand()
-    (void)assetId;
-    (void)command;
-    (void)commandArgs;
-    return true;
-}
+    using openassetio::EntityReferences;
+    using openassetio::access::RelationsAccess;
+    using openassetio::errors::BatchElementError;
+    using openassetio::hostApi::EntityReferencePagerPtr;
+    using openassetio::log::LoggerInterface;
+    using openassetio_mediacreation::specifications::lifecycle::
+        EntityVersionsRelationshipSpecification;
 
-void OpenAssetIOAsset::resolveAsset(const std::string& assetId, std::string& resolvedAsset)
-{
-    using openassetio::access::ResolveAccess;
-    using openassetio_mediacreation::traits::content::LocatableContentTrait;
+    ret.clear();
+    ret.resize(assetVersions.size());
 
-    // We don't know anything else about the asset other than its ID at this
-    // point so attempt to resolve given only the LocatableContentTrait.
-    const auto entityReference = _manager->createEntityReference(assetId);
-    const auto traitData = _manager->resolve(
-        entityReference, {LocatableContentTrait::kId}, ResolveAccess::kRead, _context);
-    const auto url = LocatableContentTrait(traitData).getLocation();
+    const auto ticket = admit(AdmissionController::Priority::kBackground);
 
-    if (!url)
+    // Assets wanted at the same version, which share a relationship
+    // predicate, so are queried together.
+    struct VersionQuery
     {
-        throw std::runtime_error{assetId + " has no location"};
-    }
-    resolvedAsset = _fileUrlPathConverter.pathFromUrl(*url);
-}
+        // Indices into `assetVersions`.
+        std::vector<std::size_t> indices;
+        EntityReferences refs;
+        std::vector<EntityReferencePagerPtr> pagers;
+    };
+    std::map<std::string_view, VersionQuery> queries;
 
-void OpenAssetIOAsset::resolveAllAssets(const std::string& id, std::string& assets)
-{
-    // TODO: Implement resolveAllAssets() - I don't understand this function
-    resolveAsset(id, assets);
-}
+    // Serve what we can from the cache, and query the rest.
+    std::vector<bool> failed(assetVersions.size(), false);
+    // As for getAssetVersionsBulk.
+    SessionPtr session;
+    for (std::size_t idx = 0; idx < assetVersions.size(); ++idx)
+    {
+        const auto& [assetId, versionTag] = assetVersions[idx];
+        if (getCached(versionedAssetIdKey(assetId, versionTag),
+                      EntityCache::Field::kVersionedAssetId,
+                      ret[idx]))
+        {
+            continue;
+        }
+        if (!session)
+        {
+            session = this->session();
+        }
+        auto entityRef = session->manager->createEntityReferenceIfValid(assetId);
+        if (!entityRef)
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  LoggerInterface::Severity::kWarning,
+                                  "OpenAssetIOAsset: '" << assetId << "' is not a valid asset ID");
+            failed[idx] = true;
+            continue;
+        }
+        VersionQuery& query = queries[versionTag];
+        query.indices.push_back(idx);
+        query.refs.push_back(std::move(*entityRef));
+    }
 
-void OpenAssetIOAsset::resolvePath(const std::string& str, const int frame, std::string& ret)
-{
-    resolveAsset(str, ret);
+    // A single relationship query per version, whose tag acts as a
+    // predicate, as for entityRefForAssetIdAndVersion. We only
+    // want/expect one result per asset.
+    constexpr std::size_t kNumExpectedResults = 1;
+    for (auto& [versionTag, query] : queries)
+    {
+        auto relationship = EntityVersionsRelationshipSpecification::create();
+        relationship.versionTrait().setSpecifiedTag(std::string{versionTag});
+
+        query.pagers.resize(query.refs.size());
+        session->manager->getWithRelationship(
+            query.refs,
+            relationship.traitsData(),
+            kNumExpectedResults,
+            RelationsAccess::kRead,
+            session->context,
+            [&query](const std::size_t queryIdx, EntityReferencePagerPtr pager)
+            { query.pagers[queryIdx] = std::move(pager); },
+            [&](const std::size_t queryIdx, const BatchElementError& error)
+            {
+                const std::size_t idx = query.indices[queryIdx];
+                KATANAOPENASSETIO_LOG(*_logger,
+                                      LoggerInterface::Severity::kWarning,
+                                      "OpenAssetIOAsset: failed to query version '"
+                                          << versionTag << "' of '"
+                                          << assetVersions[idx].first
+                                          << "': " << error.message);
+                failed[idx] = true;
+            });
+
+        for (std::size_t queryIdx = 0; queryIdx < query.pagers.size(); ++queryIdx)
+        {
+            if (!query.pagers[queryIdx])
+            {
+                continue;
+            }
+            const std::size_t idx = query.indices[queryIdx];
+            const std::string& assetId = assetVersions[idx].first;
+            const EntityReferences versionedRefs = query.pagers[queryIdx]->get();
+            if (versionedRefs.empty())
+            {
+                // As for buildAssetId, the asset is left as-is.
+                KATANAOPENASSETIO_LOG(*_logger,
+                                      LoggerInterface::Severity::kDebug,
+                                      "OpenAssetIOAsset: no results querying specific version "
+                                      "for asset '"
+                                          << assetId << "' and version '" << versionTag << "'");
+                ret[idx] = assetId;
+                continue;
+            }
+            ret[idx] = versionedRefs.front().toString();
+            _entityCache.put(versionedAssetIdKey(assetId, versionTag),
+                             EntityCache::Field::kVersionedAssetId,
+                             ret[idx]);
+        }
+    }
 
-    if (FnKat::DefaultFileSequencePlugin::isFileSequence(ret))
+    bool succeeded = true;
+    for (std::size_t idx = 0; idx < assetVersions.size(); ++idx)
     {
-        ret = FnKat::DefaultFileSequencePlugin::resolveFileSequence(ret, frame);
+        if (failed[idx])
+        {
+            ret[idx].clear();
+            succeeded = false;
+        }
     }
+    return succeeded;
 }
 
-void OpenAssetIOAsset::resolveAssetVersion(const std::string& assetId,
-                                           std::string& ret,
-                                           const std::string& versionStr)
+bool OpenAssetIOAsset::getAssetTable(const StringVector& assetIds,
+                                     std::vector<AssetTable::Column> columns,
+                                     AssetTable& ret)
 {
-    using openassetio::EntityReference;
+    using openassetio::EntityReferences;
     using openassetio::access::ResolveAccess;
+    using openassetio::errors::BatchElementError;
+    using openassetio::log::LoggerInterface;
+    using openassetio::trait::TraitSet;
+    using openassetio::trait::TraitsDataPtr;
+    using openassetio_mediacreation::traits::content::LocatableContentTrait;
+    using openassetio_mediacreation::traits::identity::DisplayNameTrait;
     using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+    using openassetio_mediacreation::traits::threeDimensional::SourcePathTrait;
+    using Column = AssetTable::Column;
 
-    const EntityReference entityReference = [&]
+    ret = AssetTable{assetIds.size(), std::move(columns)};
+    const std::vector<Column>& tableColumns = ret.columns();
+    if (tableColumns.empty())
     {
-        if (versionStr.empty())
+        return true;
+    }
+
+    // The union of the traits of every column, so that all columns
+    // are resolved together.
+    TraitSet traits;
+    bool allCacheable = true;
+    for (const Column column : tableColumns)
+    {
+        traits.insert(Queries::ColumnTrait(column));
+        allCacheable = allCacheable && columnCacheField(column).has_value();
+        if (column == Column::kLocation)
         {
-            // No alternate version, so we want to query the version
-            // tag associated with the given entity.
-            return _manager->createEntityReference(assetId);
+            // To tell whether the location may be cached.
+            traits.insert(VersionTrait::kId);
         }
-
-        // Alternate version given, so we need to query the version tag
-        // associated with the entity corresponding to the given
-        // (meta-)version. E.g. "myasset://pony" with version of
-        // "latest" has an entity reference of "myasset://pony?v=latest"
-        // which we will `resolve` below to "v2" (assuming v2 is the
-        // latest version).
-        const auto maybeEntityReference = entityRefForAssetIdAndVersion(assetId, versionStr);
-
-        if (!maybeEntityReference)
+    }
+    ret.reserve(assetIds.size() * tableColumns.size() * kAssetTableValueBytes);
+
+    const auto ticket = admit(AdmissionController::Priority::kBackground);
+
+    // Serve rows from the cache if every column is cached, and query
+    // the rest together. Indices into `assetIds` of the rows queried.
+    std::vector<std::size_t> queryRows;
+    EntityReferences queryRefs;
+    std::vector<std::string> cachedValues(tableColumns.size());
+    bool succeeded = true;
+    // As for getAssetVersionsBulk.
+    SessionPtr session;
+    for (std::size_t row = 0; row < assetIds.size(); ++row)
+    {
+        if (allCacheable)
         {
-            throw std::runtime_error{"No version found for asset " + assetId + " and version " +
-                                     versionStr};
+            std::size_t columnIdx = 0;
+            while (columnIdx < tableColumns.size() &&
+                   getCached(assetIds[row],
+                             *columnCacheField(tableColumns[columnIdx]),
+                             cachedValues[columnIdx]))
+            {
+                ++columnIdx;
+            }
+            if (columnIdx == tableColumns.size())
+            {
+                for (columnIdx = 0; columnIdx < tableColumns.size(); ++columnIdx)
+                {
+                    ret.set(row, columnIdx, cachedValues[columnIdx]);
+                }
+                continue;
+            }
         }
-        return *maybeEntityReference;
-    }();
-
-    // We don't have any other information about the asset other than its EntityReference so
-    // request the VersionTrait.
-    const auto traitData =
-        _manager->resolve(entityReference, {VersionTrait::kId}, ResolveAccess::kRead, _context);
+        if (!session)
+        {
+            session = this->session();
+        }
+        auto entityRef = session->manager->createEntityReferenceIfValid(assetIds[row]);
+        if (!entityRef)
+        {
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  LoggerInterface::Severity::kWarning,
+                                  "OpenAssetIOAsset: '" << assetIds[row]
+                                                        << "' is not a valid asset ID");
+            ret.setFailed(row);
+            succeeded = false;
+            continue;
+        }
+        queryRows.push_back(row);
+        queryRefs.push_back(std::move(*entityRef));
+    }
+    if (queryRefs.empty())
+    {
+        return succeeded;
+    }
 
-    // Usage by the Importomatic node implies "stableTag" is what we
-    // want here - its parameters panel has a column for "Version" and a
-    // column for "Resolved Version" where "Resolved Version" comes from
-    // this function (and "Version" comes from getAssetFields).
-    ret = VersionTrait{traitData}.getStableTag("");
+    // A single resolve for every column of every asset.
+    std::string value;
+    session->manager->resolve(
+        queryRefs,
+        traits,
+        ResolveAccess::kRead,
+        session->context,
+        [&](const std::size_t queryIdx, const TraitsDataPtr& traitsData)
+        {
+            const std::size_t row = queryRows[queryIdx];
+            const std::string& assetId = assetIds[row];
+            for (std::size_t columnIdx = 0; columnIdx < tableColumns.size(); ++columnIdx)
+            {
+                const Column column = tableColumns[columnIdx];
+                switch (column)
+                {
+                    case Column::kName:
+                        value = DisplayNameTrait{traitsData}.getName("");
+                        break;
+                    case Column::kVersion:
+                        value = VersionTrait{traitsData}.getSpecifiedTag("");
+                        break;
+                    case Column::kResolvedVersion:
+                        value = VersionTrait{traitsData}.getStableTag("");
+                        break;
+                    case Column::kLocation:
+                        // Left empty, rather than failing the row, if
+                        // the entity has no location.
+                        value.clear();
+                        if (const auto url = LocatableContentTrait{traitsData}.getLocation())
+                        {
+                            _fileUrlPathConverter.pathFromUrl(*url, value);
+                        }
+                        break;
+                    case Column::kScenegraphLocation:
+                        value = SourcePathTrait{traitsData}.getPath("/");
+                        break;
+                }
+                ret.set(row, columnIdx, value);
+
+                const auto field = columnCacheField(column);
+                if (!field || (column == Column::kLocation && value.empty()) ||
+                    ((column == Column::kResolvedVersion || column == Column::kLocation) &&
+                     !isStableVersion(traitsData)))
+                {
+                    continue;
+                }
+                _entityCache.put(assetId, *field, value);
+                if (column == Column::kLocation && _sharedCache)
+                {
+                    _sharedCache->put(assetId, value);
+                }
+            }
+        },
+        [&](const std::size_t queryIdx, const BatchElementError& error)
+        {
+            const std::size_t row = queryRows[queryIdx];
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  LoggerInterface::Severity::kWarning,
+                                  "OpenAssetIOAsset: failed to query '"
+                                      << assetIds[row] << "': " << error.message);
+            ret.setFailed(row);
+            succeeded = false;
+        });
+    return succeeded;
 }
 
-void OpenAssetIOAsset::getAssetDisplayName(const std::string& assetId, std::string& ret)
+bool OpenAssetIOAsset::validateAssets(const StringVector& assetIds, std::vector<Validation>& ret)
 {
+    using openassetio::EntityReferences;
     using openassetio::access::ResolveAccess;
-    using openassetio_mediacreation::traits::identity::DisplayNameTrait;
-
-    const auto entityReference = _manager->createEntityReference(assetId);
-    const auto traitData =
-        _manager->resolve(entityReference, {DisplayNameTrait::kId}, ResolveAccess::kRead, _context);
+    using openassetio::errors::BatchElementError;
+    using openassetio::log::LoggerInterface;
+    using openassetio::trait::TraitsDataPtr;
+    using openassetio_mediacreation::traits::content::LocatableContentTrait;
+    using Status = Validation::Status;
 
-    ret = DisplayNameTrait{traitData}.getName("");
-}
+    ret.clear();
+    ret.resize(assetIds.size());
 
-void OpenAssetIOAsset::getAssetVersions(const std::string& assetId, StringVector& ret)
-{
-    using openassetio::access::RelationsAccess;
-    using openassetio::access::ResolveAccess;
-    using openassetio_mediacreation::specifications::lifecycle::
-        EntityVersionsRelationshipSpecification;
-    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+    // Scenes reference the same assets many times, so each is only
+    // validated once. Indices into `assetIds` of each asset's first
+    // occurrence.
+    std::vector<std::size_t> uniqueIndices;
+    std::vector<std::size_t> firstIndices(assetIds.size());
+    {
+        std::unordered_map<std::string_view, std::size_t> seen;
+        seen.reserve(assetIds.size());
+        for (std::size_t idx = 0; idx < assetIds.size(); ++idx)
+        {
+            const auto [seenIt, inserted] = seen.try_emplace(assetIds[idx], idx);
+            firstIndices[idx] = seenIt->second;
+            if (inserted)
+            {
+                uniqueIndices.push_back(idx);
+            }
+        }
+    }
 
-    // Get all related references, such that each reference points to a
-    // different version of the same asset.
-    auto entityRefPager = _manager->getWithRelationship(
-        _manager->createEntityReference(assetId),
-        EntityVersionsRelationshipSpecification::create().traitsData(),
-        Constants::kPageSize,
-        RelationsAccess::kRead,
-        _context,
-        {});
+    // Taken up front, so that every chunk queries the same session,
+    // and the manager is loaded once rather than by whichever chunk
+    // is first.
+    const SessionPtr session = uniqueIndices.empty() ? nullptr : this->session();
 
-    openassetio::EntityReferences entityRefs;
+    const auto fail = [&ret](const std::size_t idx, const Status status, std::string message)
+    {
+        ret[idx].status = status;
+        ret[idx].message = std::move(message);
+    };
 
-    // Collect all pages of related references into a single list.
-    openassetio::EntityReferences entityRefPage;
-    while (!(entityRefPage = entityRefPager->get()).empty())
+    // Validate the unique assets in `uniqueIndices[begin, end)`.
+    const auto validateChunk = [&](const std::size_t begin, const std::size_t end)
     {
-        copy(cbegin(entityRefPage), cend(entityRefPage), back_inserter(entityRefs));
-        entityRefPager->next();
+        // Indices into `ret` of the assets that exist.
+        std::vector<std::size_t> existingIndices;
+        {
+            const auto ticket = admit(AdmissionController::Priority::kBackground);
+
+            std::vector<std::size_t> queryIndices;
+            EntityReferences queryRefs;
+            for (std::size_t uniqueIdx = begin; uniqueIdx < end; ++uniqueIdx)
+            {
+                const std::size_t idx = uniqueIndices[uniqueIdx];
+                auto entityRef = session->manager->createEntityReferenceIfValid(assetIds[idx]);
+                if (!entityRef)
+                {
+                    fail(idx, Status::kInvalid, "Not a valid asset ID");
+                    continue;
+                }
+                queryIndices.push_back(idx);
+                queryRefs.push_back(std::move(*entityRef));
+            }
+
+            // Only assets that exist are resolved.
+            std::vector<bool> exists(queryRefs.size(), false);
+            session->manager->entityExists(
+                queryRefs,
+                session->context,
+                [&](const std::size_t queryIdx, const bool entityExists)
+                {
+                    exists[queryIdx] = entityExists;
+                    if (!entityExists)
+                    {
+                        fail(queryIndices[queryIdx], Status::kMissing, "Asset does not exist");
+                    }
+                },
+                [&](const std::size_t queryIdx, const BatchElementError& error)
+                { fail(queryIndices[queryIdx], Status::kMissing, error.message); });
+            EntityReferences existingRefs;
+            for (std::size_t queryIdx = 0; queryIdx < queryRefs.size(); ++queryIdx)
+            {
+                if (exists[queryIdx])
+                {
+                    existingIndices.push_back(queryIndices[queryIdx]);
+                    existingRefs.push_back(std::move(queryRefs[queryIdx]));
+                }
+            }
+            if (existingRefs.empty())
+            {
+                return;
+            }
+
+            session->manager->resolve(
+                existingRefs,
+                Queries::LocationTraits(),
+                ResolveAccess::kRead,
+                session->context,
+                [&](const std::size_t existingIdx, const TraitsDataPtr& traitsData)
+                {
+                    const std::size_t idx = existingIndices[existingIdx];
+                    const auto url = LocatableContentTrait{traitsData}.getLocation();
+                    if (!url)
+                    {
+                        fail(idx, Status::kUnresolved, "Asset has no location");
+                        return;
+                    }
+                    try
+                    {
+                        _fileUrlPathConverter.pathFromUrl(*url, ret[idx].path);
+                    }
+                    catch (const std::exception& exc)
+                    {
+                        fail(idx, Status::kUnresolved, exc.what());
+                    }
+                },
+                [&](const std::size_t existingIdx, const BatchElementError& error)
+                { fail(existingIndices[existingIdx], Status::kUnresolved, error.message); });
+        }
+
+        // Stat the files whilst other chunks query the manager.
+        for (const std::size_t idx : existingIndices)
+        {
+            if (ret[idx].status == Status::kOk && !resolvedPathExists(ret[idx].path))
+            {
+                fail(idx, Status::kFileMissing, "File does not exist");
+            }
+        }
     };
 
-    // Batch `resolve` to get version metadata associated with each
-    // entity reference.
-    const auto traitsDatas =
-        _manager->resolve(entityRefs,
-                          {openassetio_mediacreation::traits::lifecycle::VersionTrait::kId},
-                          openassetio::access::ResolveAccess::kRead,
-                          _context);
+    if (!uniqueIndices.empty())
+    {
+        const std::size_t numChunks =
+            (uniqueIndices.size() + kValidateChunkSize - 1) / kValidateChunkSize;
+        ThreadPool pool{std::min(numChunks, kValidateThreads)};
+        std::vector<std::future<void>> chunks;
+        chunks.reserve(numChunks);
+        for (std::size_t begin = 0; begin < uniqueIndices.size(); begin += kValidateChunkSize)
+        {
+            const std::size_t end = std::min(begin + kValidateChunkSize, uniqueIndices.size());
+            chunks.push_back(pool.submit([&, begin, end] { validateChunk(begin, end); }));
+        }
 
-    // Extract and return the version "specified tag", i.e. version tag
-    // potentially including meta-versions such as "latest".
-    transform(cbegin(traitsDatas),
-              cend(traitsDatas),
-              back_inserter(ret),
-              [](const auto& traitsData) { return VersionTrait{traitsData}.getSpecifiedTag(""); });
+        // A Python manager needs the GIL, which the caller may hold.
+        // Every chunk is waited on before any error is rethrown, so
+        // that none is still running once the GIL is reacquired.
+        {
+            const ScopedGilRelease gilRelease;
+            for (std::future<void>& chunk : chunks)
+            {
+                chunk.wait();
+            }
+        }
+        for (std::future<void>& chunk : chunks)
+        {
+            chunk.get();
+        }
+    }
+
+    std::size_t numInvalid = 0;
+    for (std::size_t idx = 0; idx < assetIds.size(); ++idx)
+    {
+        if (firstIndices[idx] != idx)
+        {
+            ret[idx] = ret[firstIndices[idx]];
+        }
+        if (ret[idx].status != Status::kOk)
+        {
+            ++numInvalid;
+            KATANAOPENASSETIO_LOG(*_logger,
+                                  LoggerInterface::Severity::kDebug,
+                                  "OpenAssetIOAsset: '" << assetIds[idx] << "' is "
+                                                        << validationStatusName(ret[idx].status)
+                                                        << ": " << ret[idx].message);
+        }
+    }
+    if (numInvalid != 0)
+    {
+        KATANAOPENASSETIO_LOG(*_logger,
+                              LoggerInterface::Severity::kWarning,
+                              "OpenAssetIOAsset: " << numInvalid << " of " << assetIds.size()
+                                                   << " asset references failed validation");
+    }
+    return numInvalid == 0;
 }
 
 void OpenAssetIOAsset::getUniqueScenegraphLocationFromAssetId(const std::string& assetId,
                                                               bool includeVersion,
                                                               std::string& ret)
 {
+    const CallRecorder::Call call{_recorder.get(),
+                                  CallLog::Method::kGetUniqueScenegraphLocationFromAssetId,
+                                  assetId,
+                                  includeVersion};
+    observe(CallLog::Method::kGetUniqueScenegraphLocationFromAssetId, assetId);
+
     using openassetio::access::ResolveAccess;
-    using openassetio::trait::TraitSet;
     using openassetio_mediacreation::traits::lifecycle::VersionTrait;
     using openassetio_mediacreation::traits::threeDimensional::SourcePathTrait;
 
-    const auto traits = includeVersion ? TraitSet{VersionTrait::kId, SourcePathTrait::kId}
-                                       : TraitSet{SourcePathTrait::kId};
-
-    const auto traitsData = _manager->resolve(
-        _manager->createEntityReference(assetId), traits, ResolveAccess::kRead, _context);
+    const auto ticket = admit(AdmissionController::Priority::kInteractive);
+    const SessionPtr session = this->session();
+    const auto traitsData =
+        session->manager->resolve(session->manager->createEntityReference(assetId),
+                                  Queries::ScenegraphLocationTraits(includeVersion),
+                                  ResolveAccess::kRead,
+                                  session->context);
 
     ret = SourcePathTrait{traitsData}.getPath("/");
 
@@ -406,6 +2209,9 @@ void OpenAssetIOAsset::getRelatedAssetId(const std::string& assetId,
                                          const std::string& relation,
                                          std::string& ret)
 {
+    const CallRecorder::Call call{
+        _recorder.get(), CallLog::Method::kGetRelatedAssetId, assetId, relation};
+
     // TODO: Implement getRelatedAssetId()
     (void)assetId;
     (void)relation;
@@ -416,28 +2222,65 @@ void OpenAssetIOAsset::getAssetFields(const std::string& assetId,
                                       bool includeDefaults,
                                       StringMap& returnFields)
 {
-    (void)includeDefaults;  // TODO(DF): How should we use this?
-
-    using openassetio::access::ResolveAccess;
-    using openassetio::trait::TraitSet;
-    using openassetio_mediacreation::traits::identity::DisplayNameTrait;
-    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+    const CallRecorder::Call call{
+        _recorder.get(), CallLog::Method::kGetAssetFields, assetId, includeDefaults};
+    observe(CallLog::Method::kGetAssetFields, assetId);
 
-    const auto entityReference = _manager->createEntityReference(assetId);
+    (void)includeDefaults;  // TODO(DF): How should we use this?
 
-    const auto traitsData = _manager->resolve(entityReference,
-                                              {DisplayNameTrait::kId, VersionTrait::kId},
-                                              ResolveAccess::kRead,
-                                              _context);
+    using Field = EntityCache::Field;
 
     // Katana's AssetAPI only standardises Name & Version fields.
+    std::string& displayName = returnFields[kFnAssetFieldName];
+    std::string& versionTag = returnFields[kFnAssetFieldVersion];
     returnFields[Constants::kAssetId] = assetId;
-    returnFields[kFnAssetFieldName] = DisplayNameTrait{traitsData}.getName("");
-    returnFields[kFnAssetFieldVersion] = VersionTrait{traitsData}.getSpecifiedTag("");
+
+    if (getCached(assetId, Field::kDisplayName, displayName) &&
+        getCached(assetId, Field::kVersionTag, versionTag))
+    {
+        return;
+    }
+
+    if (_staleWhileRevalidate)
+    {
+        const EntityCache::Generation generation = _entityCache.generation();
+        const bool haveStale = getStale(assetId, Field::kDisplayName, displayName) &&
+                               getStale(assetId, Field::kVersionTag, versionTag);
+        const auto deadline =
+            std::chrono::steady_clock::now() + _staleWhileRevalidate->deadline();
+        auto values = _staleWhileRevalidate->fetch(
+            "getAssetFields:" + assetId,
+            [this, assetId, generation, session = session(), deadline]
+            {
+                StaleWhileRevalidate::Values fields(2);
+                resolveFieldsFromManager(
+                    *session, refreshPriority(deadline), assetId, fields[0], fields[1]);
+                _entityCache.put(assetId, Field::kDisplayName, fields[0], generation);
+                _entityCache.put(assetId, Field::kVersionTag, fields[1], generation);
+                return fields;
+            },
+            haveStale);
+        if (values)
+        {
+            displayName = std::move((*values)[0]);
+            versionTag = std::move((*values)[1]);
+        }
+        return;
+    }
+
+    resolveFieldsFromManager(*session(),
+                             AdmissionController::Priority::kInteractive,
+                             assetId,
+                             displayName,
+                             versionTag);
+    _entityCache.put(assetId, Field::kDisplayName, displayName);
+    _entityCache.put(assetId, Field::kVersionTag, versionTag);
 }
 
 void OpenAssetIOAsset::buildAssetId(const StringMap& fields, std::string& ret)
 {
+    const CallRecorder::Call call{_recorder.get(), CallLog::Method::kBuildAssetId, fields};
+
     using openassetio::EntityReference;
     using openassetio::EntityReferences;
     using openassetio::access::RelationsAccess;
@@ -446,7 +2289,7 @@ void OpenAssetIOAsset::buildAssetId(const StringMap& fields, std::string& ret)
         EntityVersionsRelationshipSpecification;
     using openassetio_mediacreation::traits::lifecycle::VersionTrait;
 
-    const std::string assetId = [&]
+    const std::string& assetId = [&]() -> const std::string&
     {
         // getAssetFields populates __assetId.
         if (const auto assetIdIt = fields.find(Constants::kAssetId); assetIdIt != fields.end())
@@ -460,62 +2303,100 @@ void OpenAssetIOAsset::buildAssetId(const StringMap& fields, std::string& ret)
     // versions of the same asset. So we must query for entity
     // references that are related to the input reference but that
     // point to the given version.
-    const auto versionedAssetId = [&]() -> std::optional<std::string>
+    std::optional<EntityReference> versionedRef;
+    if (const auto versionIt = fields.find(kFnAssetFieldVersion); versionIt != fields.end())
     {
-        const auto versionIt = fields.find(kFnAssetFieldVersion);
-        if (versionIt == fields.end())
+        const std::string& desiredVersionTag = versionIt->second;
+        // E.g. from an earlier bulk query.
+        const std::string cacheKey = versionedAssetIdKey(assetId, desiredVersionTag);
+        if (getCached(cacheKey, EntityCache::Field::kVersionedAssetId, ret))
         {
-            return std::nullopt;
+            return;
         }
-        const std::string& desiredVersionTag = versionIt->second;
-
-        const std::optional<EntityReference> versionedRef =
-            entityRefForAssetIdAndVersion(assetId, desiredVersionTag);
-
-        if (!versionedRef)
+        const auto ticket = admit(AdmissionController::Priority::kInteractive);
+        versionedRef = entityRefForAssetIdAndVersion(*session(), assetId, desiredVersionTag);
+        if (versionedRef)
         {
-            return std::nullopt;
+            ret = versionedRef->toString();
+            _entityCache.put(cacheKey, EntityCache::Field::kVersionedAssetId, ret);
+            return;
         }
-        return versionedRef->toString();
-    }();
+    }
 
-    ret = versionedAssetId.value_or(assetId);
+    ret = assetId;
 }
 
 void OpenAssetIOAsset::getAssetAttributes(const std::string& assetId,
-                                          [[maybe_unused]] const std::string& scope,
+                                          const std::string& scope,
                                           StringMap& returnAttrs)
 {
+    const CallRecorder::Call call{
+        _recorder.get(), CallLog::Method::kGetAssetAttributes, assetId, scope};
+    observe(CallLog::Method::kGetAssetAttributes, assetId);
+
     // TODO(DF): E.g. see CastingSheet.py - a scope of "version" is
     //  expected to (also) return a field of "type". The default File
     //  AssetAPI plugin gives the file extension as the "type".
 
-    // TODO(DF): use `scope` to filter the attributes returned(?).
-
-    using openassetio::access::EntityTraitsAccess;
+    using openassetio::access::ResolveAccess;
+    using openassetio::trait::TraitSet;
     using openassetio_mediacreation::traits::identity::DisplayNameTrait;
     using openassetio_mediacreation::traits::lifecycle::VersionTrait;
 
-    const auto entityReference = _manager->createEntityReference(assetId);
+    const auto ticket = admit(AdmissionController::Priority::kBackground);
+    const SessionPtr session = this->session();
+    const auto entityReference = session->manager->createEntityReference(assetId);
 
-    // Find out what the asset management system knows about this asset.
-    auto traitSet = _manager->entityTraits(entityReference, EntityTraitsAccess::kRead, _context);
-
-    // Augment with DisplayName and Version if it isn't specified already for Katana's
-    // specified fields
-    traitSet.insert(DisplayNameTrait::kId);
-    traitSet.insert(VersionTrait::kId);
+    // Resolve only what the scope asks for, since entities may have a
+    // great deal of metadata that isn't wanted.
+    TraitSet scopeTraits;
+    const TraitSet* traitSet = &scopeTraits;
+    if (scope == kFnAssetFieldName)
+    {
+        traitSet = &Queries::DisplayNameTraits();
+    }
+    else if (scope == kFnAssetFieldVersion)
+    {
+        traitSet = &Queries::FieldTraits();
+    }
+    else if (scope.find_first_of(kTraitIdScopeChars) != std::string::npos)
+    {
+        // Explicit list of trait IDs, which are always namespaced.
+        for (std::string_view remaining{scope}; !remaining.empty();)
+        {
+            const auto sep = remaining.find(kTraitIdSep);
+            if (const auto traitId = remaining.substr(0, sep); !traitId.empty())
+            {
+                scopeTraits.emplace(traitId);
+            }
+            remaining.remove_prefix(sep == std::string_view::npos ? remaining.size() : sep + 1);
+        }
+    }
+    else
+    {
+        // Find out what the asset management system knows about this asset.
+        scopeTraits = cachedEntityTraits(*session, assetId, entityReference);
 
-    using openassetio::access::ResolveAccess;
+        // Augment with DisplayName and Version if it isn't specified already for Katana's
+        // specified fields
+        scopeTraits.insert(DisplayNameTrait::kId);
+        scopeTraits.insert(VersionTrait::kId);
+    }
 
-    const auto traitsData =
-        _manager->resolve(entityReference, traitSet, ResolveAccess::kRead, _context);
+    const auto traitsData = session->manager->resolve(
+        entityReference, *traitSet, ResolveAccess::kRead, session->context);
 
     // Katana's AssetAPI only standardises Name & Version fields.
     // TODO(DH): Specify set of other well known fields?
     returnAttrs[Constants::kAssetId] = assetId;
-    returnAttrs[kFnAssetFieldName] = DisplayNameTrait{traitsData}.getName("");
-    returnAttrs[kFnAssetFieldVersion] = VersionTrait{traitsData}.getSpecifiedTag("");
+    if (traitSet->count(DisplayNameTrait::kId) != 0)
+    {
+        returnAttrs[kFnAssetFieldName] = DisplayNameTrait{traitsData}.getName("");
+    }
+    if (traitSet->count(VersionTrait::kId) != 0)
+    {
+        returnAttrs[kFnAssetFieldVersion] = VersionTrait{traitsData}.getSpecifiedTag("");
+    }
 
     // TODO(DH): Determine alternative way to surface traits to Katana?
     for (const auto& traitId : traitsData->traitSet())
@@ -530,14 +2411,7 @@ void OpenAssetIOAsset::getAssetAttributes(const std::string& assetId,
             // For safe use to index GroupAttributes.
             replace(begin(attrKey), end(attrKey), '.', kAssetFieldKeySep);
 
-            std::visit(
-                [&](const auto& containedValue)
-                {
-                    std::ostringstream sstr;
-                    sstr << std::boolalpha << containedValue;
-                    returnAttrs[std::move(attrKey)] = sstr.str();
-                },
-                value);
+            formatPropertyValue(value, returnAttrs[std::move(attrKey)]);
         }
     }
 }
@@ -546,6 +2420,9 @@ void OpenAssetIOAsset::setAssetAttributes(const std::string& assetId,
                                           const std::string& scope,
                                           const StringMap& attrs)
 {
+    const CallRecorder::Call call{
+        _recorder.get(), CallLog::Method::kSetAssetAttributes, assetId, scope, attrs};
+
     // TODO: Implement setAssetAttributes()
     (void)assetId;
     (void)scope;
@@ -556,6 +2433,9 @@ void OpenAssetIOAsset::getAssetIdForScope(const std::string& assetId,
                                           const std::string& scope,
                                           std::string& ret)
 {
+    const CallRecorder::Call call{
+        _recorder.get(), CallLog::Method::kGetAssetIdForScope, assetId, scope};
+
     // TODO: Implement getAssetIdForScope()
     (void)scope;
     ret = assetId;
@@ -568,6 +2448,13 @@ void OpenAssetIOAsset::createAssetAndPath(FnKat::AssetTransaction* txn,
                                           bool createDirectory,
                                           std::string& assetId)
 {
+    const CallRecorder::Call call{_recorder.get(),
+                                  CallLog::Method::kCreateAssetAndPath,
+                                  assetType,
+                                  assetFields,
+                                  args,
+                                  createDirectory};
+
     // `assetFields` comes from `getAssetFields`, with no mutations.
     //
     // `args` often starts off as a dict populated by the delegated
@@ -611,27 +2498,33 @@ void OpenAssetIOAsset::createAssetAndPath(FnKat::AssetTransaction* txn,
     using namespace openassetio_mediacreation::traits::managementPolicy;
 
     const PublishStrategy& strategy = _publishStrategies.strategyForAssetType(assetType);
+    const auto ticket = admit(AdmissionController::Priority::kInteractive);
 
-    const auto entityPolicy = _manager->managementPolicy(
-        strategy.assetTraitSet(), openassetio::access::PolicyAccess::kWrite, _context);
+    const SessionPtr session = this->session();
+    const auto entityPolicy = session->manager->managementPolicy(
+        strategy.assetTraitSet(), openassetio::access::PolicyAccess::kWrite, session->context);
 
     if (!ManagedTrait::isImbuedTo(entityPolicy))
     {
         // TODO(DH): Attempt fallback to persist basic entity?
-        FnLogWarn("OpenAssetIO Manager '" + _manager->displayName() +
-                  "' does not support trait specifiction.");
+        KATANAOPENASSETIO_LOG(*_logger,
+                              openassetio::log::LoggerInterface::Severity::kWarning,
+                              "OpenAssetIO Manager '" << session->manager->displayName()
+                                                      << "' does not support trait specifiction.");
         throw std::runtime_error("Specification not supported.");
     }
 
     // Indicate to the Manager we wish to publish something via preflight
-    const auto existingAssetId = _manager->createEntityReference(assetIdIt->second);
+    const auto existingAssetId = session->manager->createEntityReference(assetIdIt->second);
 
-    assetId = _manager
+    assetId = session->manager
                   ->preflight(existingAssetId,
                               strategy.prePublishTraitData(args),
                               openassetio::access::PublishingAccess::kWrite,
-                              _context)
+                              session->context)
                   .toString();
+    // Some managers create the working entity as a new version.
+    invalidatePublished({assetIdIt->second, assetId});
 }
 
 void OpenAssetIOAsset::postCreateAsset(FnKat::AssetTransaction* txn,
@@ -640,6 +2533,9 @@ void OpenAssetIOAsset::postCreateAsset(FnKat::AssetTransaction* txn,
                                        const StringMap& args,
                                        std::string& assetId)
 {
+    const CallRecorder::Call call{
+        _recorder.get(), CallLog::Method::kPostCreateAsset, assetType, assetFields, args};
+
     if (txn != nullptr)
     {
         throw std::runtime_error("AssetAPI transactions not yet supported.");
@@ -652,8 +2548,11 @@ void OpenAssetIOAsset::postCreateAsset(FnKat::AssetTransaction* txn,
     }
 
     const PublishStrategy& strategy = _publishStrategies.strategyForAssetType(assetType);
+    const auto ticket = admit(AdmissionController::Priority::kInteractive);
 
-    const auto workingEntityReference = _manager->createEntityReferenceIfValid(assetIdIt->second);
+    const SessionPtr session = this->session();
+    const auto workingEntityReference =
+        session->manager->createEntityReferenceIfValid(assetIdIt->second);
     if (!workingEntityReference)
     {
         throw std::runtime_error(
@@ -661,22 +2560,11 @@ void OpenAssetIOAsset::postCreateAsset(FnKat::AssetTransaction* txn,
             assetIdIt->second);
     }
 
-    assetId = _manager
+    assetId = session->manager
                   ->register_(workingEntityReference.value(),
                               strategy.postPublishTraitData(args),
                               openassetio::access::PublishingAccess::kWrite,
-                              _context)
+                              session->context)
                   .toString();
-}
-
-// --- Register plugin ------------------------
-
-DEFINE_ASSET_PLUGIN(OpenAssetIOAsset)
-
-void registerPlugins()
-{
-    REGISTER_PLUGIN(OpenAssetIOAsset,
-                    KATANA_OPENASSETIO_PLUGIN_NAME,
-                    KATANA_OPENASSETIO_PLUGIN_VERSION_MAJOR,
-                    KATANA_OPENASSETIO_PLUGIN_VERSION_MINOR);
+    invalidatePublished({assetIdIt->second, assetId});
 }
@@ -0,0 +1,295 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "PluginDiscoveryCache.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+
+#include "Constants.hpp"
+#include "Environment.hpp"
+
+namespace
+{
+constexpr std::string_view kFileMagic{"katanaopenassetio-discovery 1"};
+constexpr std::string_view kWithPython{"python"};
+constexpr std::string_view kWithoutPython{"cpp"};
+
+#ifdef _WIN32
+constexpr char kSearchPathSeparator = ';';
+#else
+constexpr char kSearchPathSeparator = ':';
+#endif
+
+// FNV-1a, which unlike std::hash is stable across builds.
+std::uint64_t stableHash(const std::string_view str)
+{
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char chr : str)
+    {
+        hash ^= static_cast<unsigned char>(chr);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string_view trim(std::string_view str)
+{
+    constexpr std::string_view kWhitespace{" \t\r\n"};
+    const auto begin = str.find_first_not_of(kWhitespace);
+    if (begin == std::string_view::npos)
+    {
+        return {};
+    }
+    return str.substr(begin, str.find_last_not_of(kWhitespace) - begin + 1);
+}
+
+// Remove the quotes from a TOML key or string value, if present.
+// Escape sequences are not supported.
+std::optional<std::string_view> unquote(const std::string_view str)
+{
+    if (str.empty() || (str.front() != '"' && str.front() != '\''))
+    {
+        return str;
+    }
+    const auto end = str.find(str.front(), 1);
+    if (end == std::string_view::npos ||
+        (str.front() == '"' && str.substr(1, end - 1).find('\\') != std::string_view::npos))
+    {
+        return std::nullopt;
+    }
+    return str.substr(1, end - 1);
+}
+}  // namespace
+
+PluginDiscoveryCache::PluginDiscoveryCache(std::filesystem::path path) : _path{std::move(path)} {}
+
+std::optional<std::filesystem::path> PluginDiscoveryCache::defaultPath(
+    const std::string& configPath,
+    const std::string& pluginPaths)
+{
+    std::filesystem::path directory;
+    if (const auto cacheDir = Environment::GetString(Constants::kDiscoveryCacheEnvVar))
+    {
+        if (*cacheDir == "0")
+        {
+            return std::nullopt;
+        }
+        directory = *cacheDir;
+    }
+#ifdef _WIN32
+    else if (const auto localAppData = Environment::GetString("LOCALAPPDATA"))
+    {
+        directory = std::filesystem::path{*localAppData} / "katanaopenassetio";
+    }
+#else
+    else if (const auto xdgCacheHome = Environment::GetString("XDG_CACHE_HOME"))
+    {
+        directory = std::filesystem::path{*xdgCacheHome} / "katanaopenassetio";
+    }
+    else if (const auto home = Environment::GetString("HOME"))
+    {
+        directory = std::filesystem::path{*home} / ".cache" / "katanaopenassetio";
+    }
+#endif
+    else
+    {
+        return std::nullopt;
+    }
+
+    char hashHex[17];
+    std::snprintf(hashHex,
+                  sizeof(hashHex),
+                  "%016llx",
+                  static_cast<unsigned long long>(stableHash(configPath + '\n' + pluginPaths)));
+    return directory / (std::string{"discovery-"} + hashHex);
+}
+
+std::vector<std::string> PluginDiscoveryCache::splitSearchPaths(const std::string& pluginPaths)
+{
+    std::vector<std::string> searchPaths;
+    std::string_view remaining{pluginPaths};
+    while (!remaining.empty())
+    {
+        const auto separator = remaining.find(kSearchPathSeparator);
+        const std::string_view searchPath = remaining.substr(0, separator);
+        if (!searchPath.empty())
+        {
+            searchPaths.emplace_back(searchPath);
+        }
+        if (separator == std::string_view::npos)
+        {
+            break;
+        }
+        remaining.remove_prefix(separator + 1);
+    }
+    return searchPaths;
+}
+
+std::optional<std::string> PluginDiscoveryCache::readManagerIdentifier(
+    const std::string& configPath)
+{
+    std::ifstream file{configPath};
+    if (!file)
+    {
+        return std::nullopt;
+    }
+
+    // Key prefix implied by the current table, e.g. "manager.".
+    std::string tablePrefix;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        const std::string_view content = trim(line);
+        if (content.empty() || content.front() == '#')
+        {
+            continue;
+        }
+        if (content.front() == '[')
+        {
+            const auto end = content.find(']');
+            if (end == std::string_view::npos || content.substr(0, 2) == "[[")
+            {
+                tablePrefix = "\n";  // Matches no key.
+                continue;
+            }
+            tablePrefix = trim(content.substr(1, end - 1));
+            tablePrefix += '.';
+            continue;
+        }
+
+        const auto equals = content.find('=');
+        if (equals == std::string_view::npos)
+        {
+            continue;
+        }
+        const auto key = unquote(trim(content.substr(0, equals)));
+        if (!key || tablePrefix + std::string{*key} != "manager.identifier")
+        {
+            continue;
+        }
+        std::string_view value = trim(content.substr(equals + 1));
+        if (value.empty() || (value.front() != '"' && value.front() != '\''))
+        {
+            return std::nullopt;
+        }
+        if (const auto identifier = unquote(value))
+        {
+            return std::string{*identifier};
+        }
+        return std::nullopt;
+    }
+    return std::nullopt;
+}
+
+std::optional<PluginDiscoveryCache::Entry> PluginDiscoveryCache::lookup(
+    const std::string& identifier,
+    const std::string& pluginPaths,
+    const bool withPython) const
+{
+    std::ifstream file{_path};
+    std::string magic;
+    std::string recordedIdentifier;
+    std::string recordedPluginPaths;
+    std::string pluginSystems;
+    Entry entry;
+    std::string mtimes;
+    if (!std::getline(file, magic) || magic != kFileMagic ||
+        !std::getline(file, recordedIdentifier) || recordedIdentifier != identifier ||
+        !std::getline(file, recordedPluginPaths) || recordedPluginPaths != pluginPaths ||
+        !std::getline(file, pluginSystems) ||
+        pluginSystems != (withPython ? kWithPython : kWithoutPython) ||
+        !std::getline(file, entry.cppSearchPath) || !std::getline(file, entry.pythonSearchPath) ||
+        !std::getline(file, mtimes))
+    {
+        return std::nullopt;
+    }
+    if (entry.cppSearchPath.empty() && entry.pythonSearchPath.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::vector<std::int64_t> recordedMtimes;
+    std::istringstream mtimesStream{mtimes};
+    for (std::int64_t mtime = 0; mtimesStream >> mtime;)
+    {
+        recordedMtimes.push_back(mtime);
+    }
+    if (recordedMtimes != searchPathMtimes(pluginPaths))
+    {
+        return std::nullopt;
+    }
+    return entry;
+}
+
+bool PluginDiscoveryCache::store(const std::string& identifier,
+                                 const std::string& pluginPaths,
+                                 const bool withPython,
+                                 const Entry& entry)
+{
+    for (const std::string* field :
+         {&identifier, &pluginPaths, &entry.cppSearchPath, &entry.pythonSearchPath})
+    {
+        if (field->find('\n') != std::string::npos)
+        {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(_path.parent_path(), error);
+    if (error)
+    {
+        return false;
+    }
+
+    // Written alongside, then renamed over, the cache file.
+    std::filesystem::path tempPath = _path;
+    tempPath += ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream file{tempPath, std::ios::trunc};
+        file << kFileMagic << '\n'
+             << identifier << '\n'
+             << pluginPaths << '\n'
+             << (withPython ? kWithPython : kWithoutPython) << '\n'
+             << entry.cppSearchPath << '\n'
+             << entry.pythonSearchPath << '\n';
+        for (const std::int64_t mtime : searchPathMtimes(pluginPaths))
+        {
+            file << mtime << ' ';
+        }
+        file << '\n';
+        if (!file.flush())
+        {
+            file.close();
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+    }
+    std::filesystem::rename(tempPath, _path, error);
+    if (error)
+    {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
+
+std::vector<std::int64_t> PluginDiscoveryCache::searchPathMtimes(const std::string& pluginPaths)
+{
+    std::vector<std::int64_t> mtimes;
+    for (const std::string& searchPath : splitSearchPaths(pluginPaths))
+    {
+        std::error_code error;
+        const auto mtime = std::filesystem::last_write_time(searchPath, error);
+        // A missing entry is recorded as such, so that creating it
+        // invalidates the record.
+        mtimes.push_back(error ? -1
+                               : static_cast<std::int64_t>(mtime.time_since_epoch().count()));
+    }
+    return mtimes;
+}
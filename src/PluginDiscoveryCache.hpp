@@ -0,0 +1,103 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Persistent record of which OpenAssetIO plugin search path entry
+ * provides a given manager, so that subsequent processes can load the
+ * manager's plugin without scanning (and importing or loading) every
+ * plugin on the search path.
+ *
+ * A record is keyed by the manager identifier and the full plugin
+ * search path, and is only valid whilst the modification time of every
+ * entry on the search path is unchanged, i.e. no plugins have been
+ * added, removed or renamed, since a plugin found earlier on the path
+ * would take precedence.
+ */
+class PluginDiscoveryCache
+{
+public:
+    /**
+     * Search path entries (directories) containing the manager's
+     * plugin, per plugin system. Empty if not provided by that plugin
+     * system. If both are set, the hybrid plugin system combines the
+     * two.
+     */
+    struct Entry
+    {
+        std::string cppSearchPath;
+        std::string pythonSearchPath;
+    };
+
+    explicit PluginDiscoveryCache(std::filesystem::path path);
+
+    /**
+     * Location of the cache file for the given configuration, under
+     * KATANAOPENASSETIO_DISCOVERY_CACHE if set, otherwise the user's
+     * cache directory.
+     *
+     * @return nullopt if caching is disabled (by setting
+     * KATANAOPENASSETIO_DISCOVERY_CACHE to "0"), or there is no
+     * suitable directory.
+     */
+    static std::optional<std::filesystem::path> defaultPath(const std::string& configPath,
+                                                            const std::string& pluginPaths);
+
+    /**
+     * Split a plugin search path on the platform's path separator,
+     * discarding empty entries.
+     */
+    static std::vector<std::string> splitSearchPaths(const std::string& pluginPaths);
+
+    /**
+     * Extract the manager identifier from an OpenAssetIO TOML config
+     * file, i.e. the `identifier` key of the `[manager]` table.
+     *
+     * Only the subset of TOML typically used for this is understood.
+     *
+     * @return nullopt if the file cannot be read, or the identifier
+     * cannot be found.
+     */
+    static std::optional<std::string> readManagerIdentifier(const std::string& configPath);
+
+    /**
+     * Look up the recorded provider of a manager.
+     *
+     * @param identifier Manager identifier.
+     * @param pluginPaths Plugin search path.
+     * @param withPython Whether the Python plugin system is in use,
+     * which must match that when the record was stored.
+     *
+     * @return nullopt if there is no matching record, or the search
+     * path has changed since it was recorded.
+     */
+    [[nodiscard]] std::optional<Entry> lookup(const std::string& identifier,
+                                              const std::string& pluginPaths,
+                                              bool withPython) const;
+
+    /**
+     * Record the provider of a manager, replacing any existing record.
+     * The file is replaced atomically, so concurrent processes see
+     * either the old or new record.
+     *
+     * @return Whether the record was written.
+     */
+    bool store(const std::string& identifier,
+               const std::string& pluginPaths,
+               bool withPython,
+               const Entry& entry);
+
+    [[nodiscard]] const std::filesystem::path& path() const { return _path; }
+
+private:
+    static std::vector<std::int64_t> searchPathMtimes(const std::string& pluginPaths);
+
+    const std::filesystem::path _path;
+};
@@ -0,0 +1,17 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "OpenAssetIOAsset.hpp"
+#include "config.hpp"
+
+// --- Register plugin ------------------------
+
+DEFINE_ASSET_PLUGIN(OpenAssetIOAsset)
+
+void registerPlugins()
+{
+    REGISTER_PLUGIN(OpenAssetIOAsset,
+                    KATANA_OPENASSETIO_PLUGIN_NAME,
+                    KATANA_OPENASSETIO_PLUGIN_VERSION_MAJOR,
+                    KATANA_OPENASSETIO_PLUGIN_VERSION_MINOR);
+}
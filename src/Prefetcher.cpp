@@ -0,0 +1,384 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "Prefetcher.hpp"
+
+#include <utility>
+
+namespace
+{
+// Number of preceding calls on a thread that a call is considered to
+// follow.
+constexpr std::size_t kWindow = 4;
+// Times an entry point must have been called before its transitions
+// are trusted.
+constexpr std::uint32_t kMinObservations = 16;
+// Frames after the current one fetched once frame stepping is learnt.
+constexpr std::int64_t kFrameLookahead = 8;
+// Most values fetched at once.
+constexpr std::size_t kMaxBatchSize = 256;
+
+constexpr const char* kDigits = "0123456789";
+
+struct RecentCall
+{
+    const Prefetcher* owner{nullptr};
+    Prefetcher::Method method{};
+    std::string assetId;
+    // Bit per entry point since called for the same asset.
+    std::uint32_t followedBy{0};
+};
+
+// The calls most recently made on this thread, as a ring.
+struct History
+{
+    std::array<RecentCall, kWindow> calls;
+    std::size_t next{0};
+};
+
+thread_local History tHistory;
+
+std::uint32_t methodBit(const Prefetcher::Method method)
+{
+    return std::uint32_t{1} << static_cast<std::uint32_t>(method);
+}
+
+std::string makeKey(const Prefetcher::Method method, const std::string_view assetId)
+{
+    std::string key;
+    key.reserve(1 + assetId.size());
+    key += static_cast<char>(method);
+    key += assetId;
+    return key;
+}
+}  // namespace
+
+Prefetcher::Prefetcher(const std::size_t budget, Fetch fetch, IsCached isCached)
+    : _budget{budget}, _fetch{std::move(fetch)}, _isCached{std::move(isCached)}
+{
+    static_assert(kNumMethods <= 32, "Entry points must fit in RecentCall::followedBy");
+}
+
+void Prefetcher::observe(const Method method, const std::string_view assetId)
+{
+    History& history = tHistory;
+
+    // Learn which calls this one follows, most recent first.
+    bool followsResolve = false;
+    for (std::size_t age = 1; age <= kWindow; ++age)
+    {
+        RecentCall& recent = history.calls[(history.next + kWindow - age) % kWindow];
+        if (recent.owner != this)
+        {
+            continue;
+        }
+        if (recent.assetId == assetId)
+        {
+            if (recent.method != method && (recent.followedBy & methodBit(method)) == 0)
+            {
+                recent.followedBy |= methodBit(method);
+                ++_transitions[static_cast<std::size_t>(recent.method)]
+                              [static_cast<std::size_t>(method)];
+            }
+        }
+        else if (method == Method::kResolveAsset && recent.method == Method::kResolveAsset &&
+                 !followsResolve)
+        {
+            followsResolve = true;
+            ++_resolveSteps;
+            if (offsetFrame(recent.assetId, 1) == assetId)
+            {
+                ++_frameSteps;
+            }
+        }
+    }
+
+    RecentCall& slot = history.calls[history.next];
+    slot.owner = this;
+    slot.method = method;
+    slot.assetId.assign(assetId);
+    slot.followedBy = 0;
+    history.next = (history.next + 1) % kWindow;
+    ++_calls[static_cast<std::size_t>(method)];
+
+    if (isPrefetchable(method))
+    {
+        const std::lock_guard lock{_mutex};
+        if (const auto it = _outstanding.find(makeKey(method, assetId)); it != _outstanding.end())
+        {
+            ++(it->second == State::kFetched ? _hits : _lateHits);
+            _outstanding.erase(it);
+        }
+    }
+
+    predict(method, assetId);
+}
+
+void Prefetcher::reset()
+{
+    const std::lock_guard lock{_mutex};
+    for (const auto& [key, state] : _outstanding)
+    {
+        if (state == State::kFetched)
+        {
+            ++_wasted;
+        }
+    }
+    _outstanding.clear();
+    _order.clear();
+    // Any batch being fetched completes, but is ignored.
+    _queue.clear();
+}
+
+Prefetcher::Counters Prefetcher::counters() const
+{
+    return Counters{_requested.load(),
+                    _prefetched.load(),
+                    _hits.load(),
+                    _lateHits.load(),
+                    _wasted.load(),
+                    _dropped.load(),
+                    _failures.load()};
+}
+
+bool Prefetcher::isPrefetchable(const Method method)
+{
+    switch (method)
+    {
+        case Method::kResolveAsset:
+        case Method::kResolveAssetVersion:
+        case Method::kGetAssetDisplayName:
+        case Method::kGetAssetVersions:
+        case Method::kGetAssetFields:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::optional<std::string> Prefetcher::offsetFrame(const std::string_view assetId,
+                                                   const std::int64_t offset)
+{
+    const std::size_t last = assetId.find_last_of(kDigits);
+    if (last == std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+    const std::size_t beforeFirst = assetId.find_last_not_of(kDigits, last);
+    const std::size_t first = beforeFirst == std::string_view::npos ? 0 : beforeFirst + 1;
+    const std::size_t width = last + 1 - first;
+    // Too long to be a frame number, and to parse without overflow.
+    if (width > 18)
+    {
+        return std::nullopt;
+    }
+
+    std::int64_t frame = 0;
+    for (std::size_t idx = first; idx <= last; ++idx)
+    {
+        frame = frame * 10 + (assetId[idx] - '0');
+    }
+    frame += offset;
+    if (frame < 0)
+    {
+        return std::nullopt;
+    }
+
+    std::string digits = std::to_string(frame);
+    std::string result;
+    result.reserve(assetId.size() + 1);
+    result.append(assetId.substr(0, first));
+    if (digits.size() < width)
+    {
+        result.append(width - digits.size(), '0');
+    }
+    result += digits;
+    result.append(assetId.substr(last + 1));
+    return result;
+}
+
+void Prefetcher::predict(const Method method, const std::string_view assetId)
+{
+    const auto methodIdx = static_cast<std::size_t>(method);
+    // Successors are predicted if they follow at least half the time.
+    if (const std::uint32_t calls = _calls[methodIdx].load(std::memory_order_relaxed);
+        calls >= kMinObservations)
+    {
+        for (std::size_t targetIdx = 0; targetIdx < kNumMethods; ++targetIdx)
+        {
+            const auto target = static_cast<Method>(targetIdx);
+            if (target != method && isPrefetchable(target) &&
+                2 * std::uint64_t{_transitions[methodIdx][targetIdx].load(
+                        std::memory_order_relaxed)} >=
+                    calls)
+            {
+                request(target, assetId);
+            }
+        }
+    }
+
+    if (method != Method::kResolveAsset)
+    {
+        return;
+    }
+    if (const std::uint32_t steps = _resolveSteps.load(std::memory_order_relaxed);
+        steps < kMinObservations ||
+        2 * std::uint64_t{_frameSteps.load(std::memory_order_relaxed)} < steps)
+    {
+        return;
+    }
+    // Frames are requested a run at a time, once the run requested
+    // for earlier frames has been reached.
+    for (std::int64_t offset = 1; offset <= kFrameLookahead; ++offset)
+    {
+        const auto frameAssetId = offsetFrame(assetId, offset);
+        if (!frameAssetId || (!request(Method::kResolveAsset, *frameAssetId) && offset == 1))
+        {
+            return;
+        }
+    }
+}
+
+bool Prefetcher::request(const Method method, const std::string_view assetId)
+{
+    if (_isCached(method, assetId))
+    {
+        return false;
+    }
+    std::string key = makeKey(method, assetId);
+
+    const std::lock_guard lock{_mutex};
+    if (_outstanding.count(key) != 0)
+    {
+        return false;
+    }
+    if (_outstanding.size() >= _budget && !makeRoomLocked())
+    {
+        ++_dropped;
+        return false;
+    }
+    _outstanding.emplace(key, State::kQueued);
+    _order.push_back(std::move(key));
+    _queue.push_back(Request{method, std::string{assetId}});
+    ++_requested;
+
+    // Drop keys since asked for, which otherwise only leave `_order`
+    // once they reach its front.
+    if (_order.size() > 2 * _budget + kMaxBatchSize)
+    {
+        std::deque<std::string> order;
+        for (std::string& orderedKey : _order)
+        {
+            if (_outstanding.count(orderedKey) != 0)
+            {
+                order.push_back(std::move(orderedKey));
+            }
+        }
+        _order = std::move(order);
+    }
+
+    if (!_draining)
+    {
+        _draining = true;
+        _pool.post([this] { drain(); });
+    }
+    return true;
+}
+
+bool Prefetcher::makeRoomLocked()
+{
+    while (!_order.empty())
+    {
+        const auto it = _outstanding.find(_order.front());
+        if (it == _outstanding.end())
+        {
+            // Since asked for.
+            _order.pop_front();
+            continue;
+        }
+        if (it->second != State::kFetched)
+        {
+            // The oldest value is yet to be fetched, so the budget is
+            // spent on work in progress.
+            return false;
+        }
+        _outstanding.erase(it);
+        _order.pop_front();
+        ++_wasted;
+        return true;
+    }
+    return false;
+}
+
+void Prefetcher::drain()
+{
+    std::vector<std::string> assetIds;
+    for (;;)
+    {
+        // Batch the oldest request with others for the same entry
+        // point.
+        Method method{};
+        assetIds.clear();
+        {
+            const std::lock_guard lock{_mutex};
+            std::deque<Request> remaining;
+            for (Request& queued : _queue)
+            {
+                const auto it = _outstanding.find(makeKey(queued.method, queued.assetId));
+                if (it == _outstanding.end() || it->second != State::kQueued)
+                {
+                    // Since asked for, so no longer worth fetching.
+                    continue;
+                }
+                if ((assetIds.empty() || queued.method == method) &&
+                    assetIds.size() < kMaxBatchSize)
+                {
+                    method = queued.method;
+                    it->second = State::kFetching;
+                    assetIds.push_back(std::move(queued.assetId));
+                }
+                else
+                {
+                    remaining.push_back(std::move(queued));
+                }
+            }
+            _queue = std::move(remaining);
+            if (assetIds.empty())
+            {
+                _draining = false;
+                return;
+            }
+        }
+
+        bool succeeded = true;
+        try
+        {
+            _fetch(method, assetIds);
+        }
+        catch (...)
+        {
+            // Tasks run by the pool mustn't throw, and the calls
+            // predicted will report the error, if it persists.
+            succeeded = false;
+        }
+
+        const std::lock_guard lock{_mutex};
+        for (const std::string& assetId : assetIds)
+        {
+            const auto it = _outstanding.find(makeKey(method, assetId));
+            if (it == _outstanding.end() || it->second != State::kFetching)
+            {
+                continue;
+            }
+            if (succeeded)
+            {
+                it->second = State::kFetched;
+            }
+            else
+            {
+                _outstanding.erase(it);
+            }
+        }
+        (succeeded ? _prefetched : _failures) += assetIds.size();
+    }
+}
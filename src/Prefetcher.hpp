@@ -0,0 +1,165 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "CallLog.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * Speculatively fetches values that AssetAPI calls are about to ask
+ * for, learnt from the calls made so far.
+ *
+ * Katana's calls are very regular, e.g. getAssetFields for an asset is
+ * usually followed by getAssetVersions for it, and resolveAsset for a
+ * frame of a sequence by the next frame. Each call is observed, and
+ * per-thread call sequences are used to count how often each entry
+ * point is followed, within the next few calls, by each other for the
+ * same asset, and how often resolveAsset is followed by that of the
+ * next frame. Once a transition has been seen often enough to be
+ * likely, each call predicts its successors, which are queued and
+ * fetched in batches on a background thread.
+ *
+ * Prefetched values that have not yet been asked for count against a
+ * budget. When it is exhausted, the oldest unused values are written
+ * off, or if none have been fetched yet, predictions are dropped, so a
+ * poor predictor costs at most the budget's worth of queries.
+ */
+class Prefetcher
+{
+public:
+    using Method = CallLog::Method;
+    /// Fetches the values of an entry point for the given assets, e.g.
+    /// into a cache, with as few queries as possible.
+    using Fetch = std::function<void(Method, const std::vector<std::string>&)>;
+    /// Returns whether the value of an entry point for an asset is
+    /// already cached, so needn't be fetched.
+    using IsCached = std::function<bool(Method, std::string_view)>;
+
+    struct Counters
+    {
+        /// Predicted values queued for fetching.
+        std::uint64_t requested;
+        /// Values fetched.
+        std::uint64_t prefetched;
+        /// Calls for which a value had been prefetched.
+        std::uint64_t hits;
+        /// Calls for which a value was queued, or still being fetched.
+        std::uint64_t lateHits;
+        /// Prefetched values discarded unused, to make room within the
+        /// budget or on `reset()`.
+        std::uint64_t wasted;
+        /// Predictions not queued as the budget was exhausted.
+        std::uint64_t dropped;
+        /// Values that failed to fetch.
+        std::uint64_t failures;
+    };
+
+    /**
+     * @param budget Maximum number of values queued, being fetched, or
+     * prefetched but not yet asked for.
+     * @param fetch Function to fetch values, called on a background
+     * thread. Should query the manager at low priority.
+     * @param isCached Function to check whether a predicted value is
+     * already available.
+     */
+    Prefetcher(std::size_t budget, Fetch fetch, IsCached isCached);
+
+    /**
+     * Note a call, predicting those to follow.
+     *
+     * @param method The entry point called.
+     * @param assetId The asset it was called for.
+     */
+    void observe(Method method, std::string_view assetId);
+
+    /**
+     * Discard queued and unused prefetched values, e.g. when caches
+     * are flushed. What has been learnt is kept.
+     */
+    void reset();
+
+    [[nodiscard]] Counters counters() const;
+
+    /**
+     * @return Whether values of the given entry point may be
+     * prefetched.
+     */
+    static bool isPrefetchable(Method method);
+
+    /**
+     * @return `assetId` with its last run of digits, e.g. a frame
+     * number, offset by `offset`, preserving any zero padding, or
+     * nullopt if it has no such number.
+     */
+    static std::optional<std::string> offsetFrame(std::string_view assetId, std::int64_t offset);
+
+private:
+    enum class State : std::uint8_t
+    {
+        kQueued,
+        kFetching,
+        kFetched,
+    };
+
+    struct Request
+    {
+        Method method;
+        std::string assetId;
+    };
+
+    static constexpr std::size_t kNumMethods = static_cast<std::size_t>(Method::kCount);
+
+    void predict(Method method, std::string_view assetId);
+    // Queue a value to fetch, returning whether it was queued.
+    bool request(Method method, std::string_view assetId);
+    bool makeRoomLocked();
+    void drain();
+
+    const std::size_t _budget;
+    const Fetch _fetch;
+    const IsCached _isCached;
+
+    // Number of times each entry point has been called, and been
+    // followed by each other, for the same asset.
+    std::array<std::atomic<std::uint32_t>, kNumMethods> _calls{};
+    std::array<std::array<std::atomic<std::uint32_t>, kNumMethods>, kNumMethods> _transitions{};
+    // Number of times resolveAsset has been followed by that of a
+    // different asset, and by that of the next frame.
+    std::atomic<std::uint32_t> _resolveSteps{0};
+    std::atomic<std::uint32_t> _frameSteps{0};
+
+    mutable std::mutex _mutex;
+    // Keyed by entry point and asset ID.
+    std::unordered_map<std::string, State> _outstanding;
+    // Keys of `_outstanding` in the order added, including some since
+    // removed.
+    std::deque<std::string> _order;
+    std::deque<Request> _queue;
+    bool _draining{false};
+
+    std::atomic<std::uint64_t> _requested{0};
+    std::atomic<std::uint64_t> _prefetched{0};
+    std::atomic<std::uint64_t> _hits{0};
+    std::atomic<std::uint64_t> _lateHits{0};
+    std::atomic<std::uint64_t> _wasted{0};
+    std::atomic<std::uint64_t> _dropped{0};
+    std::atomic<std::uint64_t> _failures{0};
+
+    // Last, so that the worker is stopped before the above is
+    // destroyed.
+    ThreadPool _pool{1};
+};
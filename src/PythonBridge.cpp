@@ -0,0 +1,142 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "PythonBridge.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include "Constants.hpp"
+#include "Environment.hpp"
+
+namespace
+{
+#ifdef _WIN32
+constexpr const char* kModuleFileName = "KatanaOpenAssetIOPythonBridge.dll";
+#else
+constexpr const char* kModuleFileName = "KatanaOpenAssetIOPythonBridge.so";
+#endif
+
+std::mutex gLoadMutex;
+std::atomic<const PythonBridge::Functions*> gFunctions{nullptr};
+
+// The binary containing this code, i.e. the plugin, or a tool it is
+// statically linked into.
+std::filesystem::path thisBinaryPath()
+{
+#ifdef _WIN32
+    HMODULE module = nullptr;
+    wchar_t path[MAX_PATH];
+    if (GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+                               GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                           reinterpret_cast<LPCWSTR>(&thisBinaryPath),
+                           &module) == 0 ||
+        GetModuleFileNameW(module, path, MAX_PATH) == 0)
+    {
+        return {};
+    }
+    return path;
+#else
+    Dl_info info{};
+    if (::dladdr(reinterpret_cast<void*>(&thisBinaryPath), &info) == 0 ||
+        info.dli_fname == nullptr)
+    {
+        return {};
+    }
+    std::error_code error;
+    return std::filesystem::canonical(info.dli_fname, error);
+#endif
+}
+
+std::filesystem::path modulePath()
+{
+    if (const auto path = Environment::GetString(Constants::kPythonBridgeEnvVar))
+    {
+        return *path;
+    }
+    return thisBinaryPath().parent_path().parent_path() / "lib" / kModuleFileName;
+}
+
+const PythonBridge::Functions* loadModule()
+{
+    const std::filesystem::path path = modulePath();
+    const auto fail = [&path](const std::string& reason)
+    {
+        return std::runtime_error{"Failed to load the Python plugin system from " +
+                                  path.string() + ": " + reason +
+                                  " - set KATANAOPENASSETIO_DISABLE_PYTHON=1 to use only C++ "
+                                  "manager plugins"};
+    };
+
+#ifdef _WIN32
+    HMODULE module = LoadLibraryW(path.c_str());
+    if (module == nullptr)
+    {
+        throw fail("error " + std::to_string(GetLastError()));
+    }
+    const auto entryPoint = reinterpret_cast<PythonBridge::EntryPoint>(
+        GetProcAddress(module, PythonBridge::kEntryPointName));
+#else
+    // Global, so that Python extension modules imported by managers can
+    // resolve libpython's symbols.
+    void* module = ::dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    if (module == nullptr)
+    {
+        throw fail(::dlerror());
+    }
+    const auto entryPoint = reinterpret_cast<PythonBridge::EntryPoint>(
+        ::dlsym(module, PythonBridge::kEntryPointName));
+#endif
+    // The module is never unloaded, since Python can't be finalised
+    // safely.
+    if (entryPoint == nullptr)
+    {
+        throw fail("no entry point");
+    }
+    const PythonBridge::Functions* functions = entryPoint();
+    if (functions == nullptr || functions->version != PythonBridge::kVersion)
+    {
+        throw fail("incompatible version");
+    }
+    return functions;
+}
+}  // namespace
+
+namespace PythonBridge
+{
+const Functions* Load()
+{
+    const Functions* functions = LoadedFunctions();
+    if (functions == nullptr)
+    {
+        const std::lock_guard lock{gLoadMutex};
+        functions = gFunctions.load(std::memory_order_relaxed);
+        if (functions == nullptr)
+        {
+            functions = loadModule();
+            gFunctions.store(functions, std::memory_order_release);
+        }
+    }
+    return functions;
+}
+
+openassetio::hostApi::ManagerImplementationFactoryInterfacePtr MakePluginSystemFactory(
+    const openassetio::log::LoggerInterfacePtr& logger,
+    const std::string* searchPaths)
+{
+    return Load()->makePluginSystemFactory(logger, searchPaths);
+}
+
+const Functions* LoadedFunctions()
+{
+    return gFunctions.load(std::memory_order_acquire);
+}
+}  // namespace PythonBridge
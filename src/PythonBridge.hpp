@@ -0,0 +1,73 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+
+/**
+ * Access to OpenAssetIO's Python plugin system, which lives in a
+ * separate module, KatanaOpenAssetIOPythonBridge, loaded on first use.
+ * Hence processes that only use C++ managers never load libpython or
+ * OpenAssetIO's Python bridge.
+ *
+ * The module is found in the `lib` directory alongside the directory
+ * of the binary using it (e.g. the plugin's `Libs` directory), unless
+ * KATANAOPENASSETIO_PYTHON_BRIDGE gives its path.
+ */
+namespace PythonBridge
+{
+/// Incremented whenever `Functions` changes.
+constexpr std::uint32_t kVersion = 1;
+
+/// Name of the module's entry point, an `EntryPoint`.
+constexpr const char* kEntryPointName = "katanaOpenAssetIOPythonBridge";
+
+/// Functions implemented by the module.
+struct Functions
+{
+    std::uint32_t version;
+    /// Create a Python plugin system factory, searching the given
+    /// paths, or OPENASSETIO_PLUGIN_PATH if null.
+    openassetio::hostApi::ManagerImplementationFactoryInterfacePtr (*makePluginSystemFactory)(
+        const openassetio::log::LoggerInterfacePtr& logger,
+        const std::string* searchPaths);
+    /// Release the GIL, if held, returning the thread state to pass to
+    /// `restoreGil`, or null if not held.
+    void* (*releaseGil)();
+    void (*restoreGil)(void* threadState);
+};
+
+using EntryPoint = const Functions* (*)();
+
+/**
+ * Load the module, if not already loaded, e.g. by a Python extension
+ * that needs manager calls it blocks on to release the GIL.
+ *
+ * @throws std::runtime_error If the module cannot be loaded.
+ */
+const Functions* Load();
+
+/**
+ * Create a Python plugin system factory, loading the module if not
+ * already loaded.
+ *
+ * @param searchPaths Plugin search paths, or null to use
+ * OPENASSETIO_PLUGIN_PATH.
+ *
+ * @throws std::runtime_error If the module cannot be loaded.
+ */
+openassetio::hostApi::ManagerImplementationFactoryInterfacePtr MakePluginSystemFactory(
+    const openassetio::log::LoggerInterfacePtr& logger,
+    const std::string* searchPaths);
+
+/**
+ * @return The module's functions, or null if it hasn't been loaded, in
+ * which case no Python manager can be in use.
+ */
+const Functions* LoadedFunctions();
+}  // namespace PythonBridge
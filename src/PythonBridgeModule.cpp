@@ -0,0 +1,134 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// KatanaOpenAssetIOPythonBridge: OpenAssetIO's Python plugin system,
+// loaded by the plugin only if Python managers are enabled (see
+// PythonBridge.hpp), so that it alone links libpython and OpenAssetIO's
+// Python bridge.
+#include <Python.h>
+
+#include <stdexcept>
+#include <string>
+
+#include <openassetio/python/converter.hpp>
+#include <openassetio/python/hostApi.hpp>
+
+#include "PythonBridge.hpp"
+
+#if defined(_WIN32)
+#define KATANAOPENASSETIO_BRIDGE_EXPORT __declspec(dllexport)
+#else
+#define KATANAOPENASSETIO_BRIDGE_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace
+{
+using openassetio::hostApi::ManagerImplementationFactoryInterface;
+using openassetio::hostApi::ManagerImplementationFactoryInterfacePtr;
+using openassetio::log::LoggerInterfacePtr;
+
+// Owned reference to a Python object.
+struct PyObjectRef
+{
+    explicit PyObjectRef(PyObject* object) : ptr{object} {}
+    ~PyObjectRef() { Py_XDECREF(ptr); }
+    PyObjectRef(const PyObjectRef&) = delete;
+    PyObjectRef& operator=(const PyObjectRef&) = delete;
+
+    PyObject* ptr;
+};
+
+// Take the current Python exception, and return its message.
+std::string takePythonError()
+{
+    PyObject* type = nullptr;
+    PyObject* value = nullptr;
+    PyObject* traceback = nullptr;
+    PyErr_Fetch(&type, &value, &traceback);
+    const PyObjectRef typeRef{type};
+    const PyObjectRef valueRef{value};
+    const PyObjectRef tracebackRef{traceback};
+
+    if (value != nullptr)
+    {
+        const PyObjectRef str{PyObject_Str(value)};
+        if (const char* utf8 = str.ptr != nullptr ? PyUnicode_AsUTF8(str.ptr) : nullptr)
+        {
+            return utf8;
+        }
+        PyErr_Clear();
+    }
+    return "unknown Python error";
+}
+
+// Create a Python plugin system factory that searches only the given
+// paths. The C++ convenience function for this only supports the
+// default (environment) search path.
+ManagerImplementationFactoryInterfacePtr makeSearchPathFactory(const std::string& searchPaths,
+                                                               const LoggerInterfacePtr& logger)
+{
+    namespace converter = openassetio::python::converter;
+
+    const PyGILState_STATE gilState = PyGILState_Ensure();
+    struct GilRelease
+    {
+        PyGILState_STATE state;
+        ~GilRelease() { PyGILState_Release(state); }
+    } const gilRelease{gilState};
+
+    const PyObjectRef module{PyImport_ImportModule("openassetio.pluginSystem")};
+    const PyObjectRef factoryClass{
+        module.ptr != nullptr
+            ? PyObject_GetAttrString(module.ptr, "PythonPluginSystemManagerImplementationFactory")
+            : nullptr};
+    const PyObjectRef pyLogger{converter::castToPyObject(logger)};
+    const PyObjectRef args{pyLogger.ptr != nullptr ? PyTuple_Pack(1, pyLogger.ptr) : nullptr};
+    const PyObjectRef kwargs{Py_BuildValue("{s:s}", "paths", searchPaths.c_str())};
+    if (factoryClass.ptr == nullptr || args.ptr == nullptr || kwargs.ptr == nullptr)
+    {
+        throw std::runtime_error{takePythonError()};
+    }
+    const PyObjectRef pyFactory{PyObject_Call(factoryClass.ptr, args.ptr, kwargs.ptr)};
+    if (pyFactory.ptr == nullptr)
+    {
+        throw std::runtime_error{takePythonError()};
+    }
+    return converter::castFromPyObject<ManagerImplementationFactoryInterface>(pyFactory.ptr);
+}
+
+ManagerImplementationFactoryInterfacePtr makePluginSystemFactory(const LoggerInterfacePtr& logger,
+                                                                 const std::string* searchPaths)
+{
+    if (searchPaths != nullptr)
+    {
+        return makeSearchPathFactory(*searchPaths, logger);
+    }
+    return openassetio::python::hostApi::createPythonPluginSystemManagerImplementationFactory(
+        logger);
+}
+
+void* releaseGil()
+{
+    if (Py_IsInitialized() && PyGILState_Check())
+    {
+        return PyEval_SaveThread();
+    }
+    return nullptr;
+}
+
+void restoreGil(void* threadState)
+{
+    PyEval_RestoreThread(static_cast<PyThreadState*>(threadState));
+}
+}  // namespace
+
+extern "C"
+{
+    KATANAOPENASSETIO_BRIDGE_EXPORT const PythonBridge::Functions* katanaOpenAssetIOPythonBridge()
+    {
+        static const PythonBridge::Functions kFunctions{
+            PythonBridge::kVersion, &makePluginSystemFactory, &releaseGil, &restoreGil};
+        return &kFunctions;
+    }
+}
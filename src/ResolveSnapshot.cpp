@@ -0,0 +1,387 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ResolveSnapshot.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <system_error>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+constexpr std::uint64_t kMagic = 0x50414E534F49414FULL;  // "OAIOSNAP"
+constexpr std::uint32_t kLayoutVersion = 1;
+
+// FNV-1a, which unlike std::hash is stable across builds.
+std::uint64_t stableHash(const std::string_view str)
+{
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char chr : str)
+    {
+        hash ^= static_cast<unsigned char>(chr);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::int64_t toSeconds(const ResolveSnapshot::Clock::time_point time)
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count();
+}
+}  // namespace
+
+struct ResolveSnapshot::Header
+{
+    std::uint64_t magic;
+    std::uint32_t layoutVersion;
+    std::uint32_t entryCount;
+    std::uint64_t generation;
+    // Seconds since the epoch.
+    std::int64_t savedAt;
+    std::uint64_t configurationHash;
+    std::uint64_t stringsSize;
+    std::uint64_t reserved[2];
+};
+
+struct ResolveSnapshot::Entry
+{
+    std::uint64_t keyHash;
+    // Seconds since the epoch.
+    std::int64_t resolvedAt;
+    // Offsets into the string data that follows the entries.
+    std::uint32_t keyOffset;
+    std::uint32_t keyLength;
+    std::uint32_t valueOffset;
+    std::uint32_t valueLength;
+    std::uint8_t field;
+    std::uint8_t reserved[7];
+
+    // Entries are sorted by asset ID hash, then field.
+    bool operator<(const Entry& other) const
+    {
+        return std::tie(keyHash, field) < std::tie(other.keyHash, other.field);
+    }
+};
+
+std::unique_ptr<ResolveSnapshot> ResolveSnapshot::open(const std::filesystem::path& path,
+                                                       const std::string_view configuration)
+{
+    static_assert(sizeof(Header) == 64);
+    static_assert(sizeof(Entry) == 40);
+
+#ifdef _WIN32
+    (void)path;
+    (void)configuration;
+    return nullptr;
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+    struct stat stats{};
+    if (::fstat(fd, &stats) != 0 || static_cast<std::size_t>(stats.st_size) < sizeof(Header))
+    {
+        ::close(fd);
+        return nullptr;
+    }
+    const auto mappedSize = static_cast<std::size_t>(stats.st_size);
+    void* const mapped = ::mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    // Entries are validated as they are looked up.
+    const auto& header = *static_cast<const Header*>(mapped);
+    if (header.magic != kMagic || header.layoutVersion != kLayoutVersion ||
+        header.configurationHash != stableHash(configuration) ||
+        sizeof(Header) + std::uint64_t{header.entryCount} * sizeof(Entry) + header.stringsSize !=
+            mappedSize)
+    {
+        ::munmap(mapped, mappedSize);
+        return nullptr;
+    }
+    return std::unique_ptr<ResolveSnapshot>{
+        new ResolveSnapshot{static_cast<const char*>(mapped), mappedSize}};
+#endif
+}
+
+bool ResolveSnapshot::save(const std::filesystem::path& path,
+                           const std::string_view configuration,
+                           const EntityCache& cache,
+                           const ResolveSnapshot* previous)
+{
+    const std::uint64_t generation = previous != nullptr ? previous->generation() + 1 : 0;
+    if (previous != nullptr && previous->_discarded.load(std::memory_order_relaxed))
+    {
+        previous = nullptr;
+    }
+
+    std::vector<Entry> entries;
+    std::string strings;
+    // Each asset ID is stored once, for all its fields.
+    std::unordered_map<std::string, std::uint32_t> keyOffsets;
+    bool overflowed = false;
+
+    const auto append = [&](const std::string_view assetId,
+                            const Field field,
+                            const std::string_view value,
+                            const std::int64_t resolvedAt)
+    {
+        if (strings.size() + assetId.size() + value.size() >
+            std::numeric_limits<std::uint32_t>::max())
+        {
+            overflowed = true;
+            return;
+        }
+        const auto [keyIt, inserted] = keyOffsets.try_emplace(
+            std::string{assetId}, static_cast<std::uint32_t>(strings.size()));
+        if (inserted)
+        {
+            strings += assetId;
+        }
+        Entry& entry = entries.emplace_back();
+        entry.keyHash = stableHash(assetId);
+        entry.resolvedAt = resolvedAt;
+        entry.keyOffset = keyIt->second;
+        entry.keyLength = static_cast<std::uint32_t>(assetId.size());
+        entry.valueOffset = static_cast<std::uint32_t>(strings.size());
+        entry.valueLength = static_cast<std::uint32_t>(value.size());
+        entry.field = static_cast<std::uint8_t>(field);
+        strings += value;
+    };
+
+    const std::int64_t now = toSeconds(Clock::now());
+    cache.forEach(
+        [&](const std::string_view assetId, const Field field, const std::string_view value)
+        {
+            std::int64_t resolvedAt = now;
+            if (previous != nullptr)
+            {
+                // E.g. served from the snapshot, and not since refreshed.
+                const Entry* previousEntry = previous->find(assetId, field);
+                if (previousEntry != nullptr &&
+                    previous->string(previousEntry->valueOffset, previousEntry->valueLength) ==
+                        value)
+                {
+                    resolvedAt = previousEntry->resolvedAt;
+                }
+            }
+            append(assetId, field, value, resolvedAt);
+        });
+
+    if (previous != nullptr)
+    {
+        // Carry over values not used this session, until they expire.
+        std::string cachedValue;
+        const Entry* const previousEntries = previous->entries();
+        for (std::uint32_t idx = 0; idx < previous->header().entryCount; ++idx)
+        {
+            const Entry& entry = previousEntries[idx];
+            const auto assetId = previous->string(entry.keyOffset, entry.keyLength);
+            const auto value = previous->string(entry.valueOffset, entry.valueLength);
+            if (!assetId || !value ||
+                entry.field > static_cast<std::uint8_t>(Field::kStableVersionTag))
+            {
+                continue;
+            }
+            const auto field = static_cast<Field>(entry.field);
+            if (now - entry.resolvedAt > maxAge(field).count() ||
+                cache.get(*assetId, field, cachedValue))
+            {
+                continue;
+            }
+            append(*assetId, field, *value, entry.resolvedAt);
+        }
+    }
+
+    if (overflowed || entries.size() > std::numeric_limits<std::uint32_t>::max())
+    {
+        return false;
+    }
+    std::sort(entries.begin(), entries.end());
+
+    Header header{};
+    header.magic = kMagic;
+    header.layoutVersion = kLayoutVersion;
+    header.entryCount = static_cast<std::uint32_t>(entries.size());
+    header.generation = generation;
+    header.savedAt = now;
+    header.configurationHash = stableHash(configuration);
+    header.stringsSize = strings.size();
+
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    // Written alongside, then renamed over, the snapshot, which other
+    // sessions may have mapped.
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream file{tempPath, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()),
+                   static_cast<std::streamsize>(entries.size() * sizeof(Entry)));
+        file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+        if (!file.flush())
+        {
+            file.close();
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+    }
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
+
+std::chrono::seconds ResolveSnapshot::maxAge(const Field field)
+{
+    using std::chrono::hours;
+    using std::chrono::minutes;
+
+    switch (field)
+    {
+        case Field::kEntityTraits:
+            // The kind of an entity doesn't change.
+            return hours{24 * 7};
+        case Field::kDisplayName:
+            return hours{24};
+        case Field::kVersionTag:
+        case Field::kVersionedAssetId:
+        case Field::kStableVersionTag:
+            // Meta-versions are re-pointed as versions are published.
+            return hours{1};
+        case Field::kLocation:
+            // Changes whenever a meta-version such as "latest" is
+            // re-pointed, and references to meta-versions can't be told
+            // apart from others.
+        case Field::kVersions:
+            // Grows as versions are published.
+            return minutes{10};
+    }
+    return std::chrono::seconds{0};
+}
+
+ResolveSnapshot::ResolveSnapshot(const char* data, const std::size_t size)
+    : _data{data}, _size{size}
+{
+}
+
+ResolveSnapshot::~ResolveSnapshot()
+{
+#ifndef _WIN32
+    ::munmap(const_cast<char*>(_data), _size);
+#endif
+}
+
+bool ResolveSnapshot::get(const std::string_view assetId,
+                          const Field field,
+                          std::string& out) const
+{
+    if (_discarded.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+    const Entry* entry = find(assetId, field);
+    if (entry == nullptr)
+    {
+        return false;
+    }
+    const std::int64_t age = toSeconds(Clock::now()) - entry->resolvedAt;
+    // A negative age means the clock has gone backwards, so the value
+    // can't be trusted either.
+    if (age < 0 || age > maxAge(field).count())
+    {
+        return false;
+    }
+    const auto value = string(entry->valueOffset, entry->valueLength);
+    if (!value)
+    {
+        return false;
+    }
+    out.assign(*value);
+    return true;
+}
+
+void ResolveSnapshot::discard()
+{
+    _discarded.store(true, std::memory_order_relaxed);
+}
+
+std::uint64_t ResolveSnapshot::generation() const
+{
+    return header().generation;
+}
+
+ResolveSnapshot::Clock::time_point ResolveSnapshot::savedAt() const
+{
+    return Clock::time_point{std::chrono::seconds{header().savedAt}};
+}
+
+std::size_t ResolveSnapshot::size() const
+{
+    return header().entryCount;
+}
+
+const ResolveSnapshot::Header& ResolveSnapshot::header() const
+{
+    return *reinterpret_cast<const Header*>(_data);
+}
+
+const ResolveSnapshot::Entry* ResolveSnapshot::entries() const
+{
+    return reinterpret_cast<const Entry*>(_data + sizeof(Header));
+}
+
+std::optional<std::string_view> ResolveSnapshot::string(const std::uint32_t offset,
+                                                        const std::uint32_t length) const
+{
+    const Header& snapshotHeader = header();
+    if (std::uint64_t{offset} + length > snapshotHeader.stringsSize)
+    {
+        return std::nullopt;
+    }
+    const char* const strings =
+        _data + sizeof(Header) + std::size_t{snapshotHeader.entryCount} * sizeof(Entry);
+    return std::string_view{strings + offset, length};
+}
+
+const ResolveSnapshot::Entry* ResolveSnapshot::find(const std::string_view assetId,
+                                                    const Field field) const
+{
+    Entry key{};
+    key.keyHash = stableHash(assetId);
+    key.field = static_cast<std::uint8_t>(field);
+
+    const Entry* const first = entries();
+    const Entry* const last = first + header().entryCount;
+    for (const Entry* entry = std::lower_bound(first, last, key);
+         entry != last && !(key < *entry);
+         ++entry)
+    {
+        if (string(entry->keyOffset, entry->keyLength) == assetId)
+        {
+            return entry;
+        }
+    }
+    return nullptr;
+}
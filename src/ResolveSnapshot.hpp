@@ -0,0 +1,126 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "EntityCache.hpp"
+
+/**
+ * Read-only, memory-mapped snapshot of values resolved in an earlier
+ * session, such that reopening a scene needn't re-resolve every asset
+ * before the manager is queried.
+ *
+ * The file is a header, an array of fixed-size entries sorted by the
+ * hash of their asset ID and field, and a block of string data. Only
+ * the header is checked when opening; each entry is bounds-checked when
+ * looked up, so a corrupt entry is a miss rather than a crash, and
+ * opening a large snapshot costs no more than mapping it.
+ *
+ * Each entry records when its value was resolved, and is served only
+ * until a maximum age that depends on its field, according to how
+ * volatile that field is: e.g. the traits of an entity never change,
+ * whereas new versions may be published at any time.
+ *
+ * A snapshot is only valid for the manager configuration it was saved
+ * under. Snapshots are replaced atomically, so concurrent sessions
+ * never see a partially written file.
+ */
+class ResolveSnapshot
+{
+public:
+    using Field = EntityCache::Field;
+    using Clock = std::chrono::system_clock;
+
+    /**
+     * Map a snapshot file.
+     *
+     * @param path Snapshot file.
+     * @param configuration Identifies the manager configuration, e.g.
+     * its fingerprint.
+     *
+     * @return The snapshot, or null if there is no snapshot at `path`,
+     * or it is invalid, or was saved under a different configuration.
+     */
+    static std::unique_ptr<ResolveSnapshot> open(const std::filesystem::path& path,
+                                                 std::string_view configuration);
+
+    /**
+     * Save the fresh values in `cache`, along with any values in
+     * `previous` that are neither in `cache` nor have expired, by
+     * writing alongside then renaming over `path`.
+     *
+     * Values unchanged since `previous` keep their original resolve
+     * time, so they still expire.
+     *
+     * @return Whether the snapshot was written.
+     */
+    static bool save(const std::filesystem::path& path,
+                     std::string_view configuration,
+                     const EntityCache& cache,
+                     const ResolveSnapshot* previous);
+
+    /**
+     * @return The duration for which values of the given field are
+     * served after being resolved.
+     */
+    static std::chrono::seconds maxAge(Field field);
+
+    ~ResolveSnapshot();
+
+    ResolveSnapshot(const ResolveSnapshot&) = delete;
+    ResolveSnapshot& operator=(const ResolveSnapshot&) = delete;
+
+    /**
+     * Look up a value that has not expired.
+     *
+     * @return Whether a value was found, in which case `out` is set.
+     */
+    bool get(std::string_view assetId, Field field, std::string& out) const;
+
+    /**
+     * Stop serving values, e.g. when caches are flushed. The snapshot
+     * remains mapped, so is safe to use concurrently.
+     */
+    void discard();
+
+    /**
+     * @return Number of times this snapshot has been saved over.
+     */
+    [[nodiscard]] std::uint64_t generation() const;
+
+    /**
+     * @return When the snapshot was saved.
+     */
+    [[nodiscard]] Clock::time_point savedAt() const;
+
+    /**
+     * @return Number of values in the snapshot, including expired ones.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    struct Header;
+    struct Entry;
+
+    ResolveSnapshot(const char* data, std::size_t size);
+
+    [[nodiscard]] const Header& header() const;
+    [[nodiscard]] const Entry* entries() const;
+    [[nodiscard]] std::optional<std::string_view> string(std::uint32_t offset,
+                                                         std::uint32_t length) const;
+    [[nodiscard]] const Entry* find(std::string_view assetId, Field field) const;
+
+    const char* _data;
+    std::size_t _size;
+    std::atomic<bool> _discarded{false};
+};
@@ -0,0 +1,209 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ResolverClient.hpp"
+
+#include <cstring>
+#include <utility>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+// How long to wait before trying to reconnect to an unreachable daemon.
+constexpr std::chrono::seconds kReconnectBackoff{5};
+}  // namespace
+
+ResolverClient::ResolverClient(std::string socketPath, const std::chrono::milliseconds timeout)
+    : _socketPath{std::move(socketPath)}, _timeout{timeout}
+{
+}
+
+ResolverClient::~ResolverClient()
+{
+#ifndef _WIN32
+    for (const int fd : _idleConnections)
+    {
+        ::close(fd);
+    }
+#endif
+}
+
+bool ResolverClient::resolveLocations(const std::vector<std::string_view>& assetIds,
+                                      std::vector<ResolverProtocol::Result>& results)
+{
+    return transact(
+        ResolverProtocol::MessageType::kResolveLocations, assetIds, assetIds.size(), results);
+}
+
+bool ResolverClient::flush()
+{
+    std::vector<ResolverProtocol::Result> results;
+    return transact(ResolverProtocol::MessageType::kFlush, {}, 0, results);
+}
+
+bool ResolverClient::entityReferencePrefix(std::optional<std::string>& prefix)
+{
+    std::vector<ResolverProtocol::Result> results;
+    if (!transact(ResolverProtocol::MessageType::kEntityReferencePrefix, {}, 1, results))
+    {
+        return false;
+    }
+    prefix.reset();
+    if (results.front().status == ResolverProtocol::Status::kOk)
+    {
+        prefix = std::move(results.front().value);
+    }
+    return true;
+}
+
+bool ResolverClient::transact(const ResolverProtocol::MessageType type,
+                              const std::vector<std::string_view>& items,
+                              const std::size_t numResults,
+                              std::vector<ResolverProtocol::Result>& results)
+{
+    bool pooled = false;
+    int fd = acquireConnection(pooled);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    bool exchanged = exchange(fd, type, items, numResults, results);
+    // A pooled connection may have been closed by the daemon since it
+    // was last used, e.g. as the daemon was restarted. That fails
+    // promptly, so try once more on a fresh connection before backing
+    // off, unless the failure was the daemon not answering in time.
+    if (!exchanged && pooled && std::chrono::steady_clock::now() - start < _timeout)
+    {
+        closeConnection(fd);
+        fd = openConnection();
+        if (fd < 0)
+        {
+            return false;
+        }
+        exchanged = exchange(fd, type, items, numResults, results);
+    }
+    if (!exchanged)
+    {
+        // The stream is in an unknown state, so don't reuse it.
+        closeConnection(fd);
+        markUnavailable();
+        return false;
+    }
+
+    releaseConnection(fd);
+    return true;
+}
+
+bool ResolverClient::exchange(const int fd,
+                              const ResolverProtocol::MessageType type,
+                              const std::vector<std::string_view>& items,
+                              const std::size_t numResults,
+                              std::vector<ResolverProtocol::Result>& results)
+{
+    // Reused across calls on the same thread, to avoid reallocating.
+    thread_local std::string buffer;
+    ResolverProtocol::EncodeRequest(type, items, buffer);
+
+    ResolverProtocol::Header header{};
+    return ResolverProtocol::WriteMessage(fd, buffer) &&
+           ResolverProtocol::ReadMessage(fd, header, buffer) &&
+           header.type == ResolverProtocol::MessageType::kResults && header.count == numResults &&
+           ResolverProtocol::DecodeResults(header, buffer, results);
+}
+
+int ResolverClient::acquireConnection(bool& pooled)
+{
+    pooled = false;
+#ifdef _WIN32
+    return -1;
+#else
+    if (std::chrono::steady_clock::now().time_since_epoch().count() < _retryAfter.load())
+    {
+        return -1;
+    }
+    {
+        const std::lock_guard lock{_mutex};
+        if (!_idleConnections.empty())
+        {
+            const int fd = _idleConnections.back();
+            _idleConnections.pop_back();
+            pooled = true;
+            return fd;
+        }
+    }
+    return openConnection();
+#endif
+}
+
+int ResolverClient::openConnection()
+{
+#ifdef _WIN32
+    return -1;
+#else
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (_socketPath.size() >= sizeof(address.sun_path))
+    {
+        markUnavailable();
+        return -1;
+    }
+    std::memcpy(address.sun_path, _socketPath.c_str(), _socketPath.size() + 1);
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        markUnavailable();
+        return -1;
+    }
+    // A hung daemon should cost a bounded wait, after which the caller
+    // falls back to its own manager, rather than block Katana.
+    timeval timeout{};
+    timeout.tv_sec = static_cast<decltype(timeout.tv_sec)>(_timeout.count() / 1000);
+    timeout.tv_usec = static_cast<decltype(timeout.tv_usec)>((_timeout.count() % 1000) * 1000);
+    if (::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0 ||
+        ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) != 0 ||
+        ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        ::close(fd);
+        markUnavailable();
+        return -1;
+    }
+    // Don't trust paths resolved by a process run by someone else,
+    // e.g. one that has taken over the socket path.
+    if (!ResolverProtocol::IsPeerCurrentUser(fd))
+    {
+        ::close(fd);
+        markUnavailable();
+        return -1;
+    }
+    return fd;
+#endif
+}
+
+void ResolverClient::releaseConnection(const int fd)
+{
+    const std::lock_guard lock{_mutex};
+    _idleConnections.push_back(fd);
+}
+
+void ResolverClient::closeConnection(const int fd)
+{
+#ifndef _WIN32
+    ::close(fd);
+#else
+    static_cast<void>(fd);
+#endif
+}
+
+void ResolverClient::markUnavailable()
+{
+    _retryAfter = (std::chrono::steady_clock::now() + kReconnectBackoff).time_since_epoch().count();
+}
@@ -0,0 +1,89 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ResolverProtocol.hpp"
+
+/**
+ * Client for the resolver daemon, which owns the manager on behalf of
+ * all Katana processes on a host.
+ *
+ * Connections are pooled, so concurrent callers each get their own
+ * socket. If the daemon cannot be reached, does not answer within the
+ * timeout, or is not run by the current user, requests fail fast for a
+ * back-off period rather than attempt to reconnect on every call.
+ */
+class ResolverClient
+{
+public:
+    ResolverClient(std::string socketPath, std::chrono::milliseconds timeout);
+    ~ResolverClient();
+
+    ResolverClient(const ResolverClient&) = delete;
+    ResolverClient& operator=(const ResolverClient&) = delete;
+
+    /**
+     * Resolve file system paths for a batch of asset IDs in a single
+     * round trip.
+     *
+     * @param assetIds Asset IDs to resolve.
+     * @param results Set to one result per asset ID, in order.
+     *
+     * @return False if the daemon could not be reached, in which case
+     * the caller should fall back to querying the manager directly.
+     */
+    bool resolveLocations(const std::vector<std::string_view>& assetIds,
+                          std::vector<ResolverProtocol::Result>& results);
+
+    /**
+     * Ask the daemon to discard its cache.
+     *
+     * @return False if the daemon could not be reached.
+     */
+    bool flush();
+
+    /**
+     * Ask the daemon for the prefix that all of its manager's entity
+     * references start with.
+     *
+     * @param prefix Set to the prefix, or nullopt if the manager
+     * doesn't have one.
+     *
+     * @return False if the daemon could not be reached.
+     */
+    bool entityReferencePrefix(std::optional<std::string>& prefix);
+
+    [[nodiscard]] const std::string& socketPath() const { return _socketPath; }
+
+private:
+    bool transact(ResolverProtocol::MessageType type,
+                  const std::vector<std::string_view>& items,
+                  std::size_t numResults,
+                  std::vector<ResolverProtocol::Result>& results);
+    bool exchange(int fd,
+                  ResolverProtocol::MessageType type,
+                  const std::vector<std::string_view>& items,
+                  std::size_t numResults,
+                  std::vector<ResolverProtocol::Result>& results);
+    int acquireConnection(bool& pooled);
+    int openConnection();
+    void releaseConnection(int fd);
+    static void closeConnection(int fd);
+    void markUnavailable();
+
+    const std::string _socketPath;
+    const std::chrono::milliseconds _timeout;
+    std::mutex _mutex;
+    std::vector<int> _idleConnections;
+    std::atomic<std::chrono::steady_clock::rep> _retryAfter{0};
+};
@@ -0,0 +1,239 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ResolverProtocol.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include "Environment.hpp"
+
+namespace ResolverProtocol
+{
+namespace
+{
+template <typename T>
+void appendPod(std::string& out, const T& value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readPod(std::string_view& cursor, T& value)
+{
+    if (cursor.size() < sizeof(T))
+    {
+        return false;
+    }
+    std::memcpy(&value, cursor.data(), sizeof(T));
+    cursor.remove_prefix(sizeof(T));
+    return true;
+}
+
+void appendString(std::string& out, const std::string_view str)
+{
+    appendPod(out, static_cast<std::uint32_t>(str.size()));
+    out.append(str);
+}
+
+bool readString(std::string_view& cursor, std::string_view& str)
+{
+    std::uint32_t size = 0;
+    if (!readPod(cursor, size) || cursor.size() < size)
+    {
+        return false;
+    }
+    str = cursor.substr(0, size);
+    cursor.remove_prefix(size);
+    return true;
+}
+
+void beginMessage(const MessageType type, const std::size_t count, std::string& out)
+{
+    out.clear();
+    appendPod(out, Header{kMagic, kVersion, type, static_cast<std::uint32_t>(count), 0});
+}
+
+void endMessage(std::string& out)
+{
+    const std::size_t payloadSize = out.size() - sizeof(Header);
+    if (payloadSize > kMaxPayloadSize)
+    {
+        throw std::length_error{"Resolver message too large"};
+    }
+    const auto size32 = static_cast<std::uint32_t>(payloadSize);
+    std::memcpy(out.data() + offsetof(Header, payloadSize), &size32, sizeof(size32));
+}
+
+#ifndef _WIN32
+bool readAll(const int fd, char* data, std::size_t size)
+{
+    while (size > 0)
+    {
+        const ssize_t received = ::recv(fd, data, size, 0);
+        if (received < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (received <= 0)
+        {
+            return false;
+        }
+        data += received;
+        size -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+#endif
+}  // namespace
+
+void EncodeRequest(const MessageType type,
+                   const std::vector<std::string_view>& items,
+                   std::string& out)
+{
+    beginMessage(type, items.size(), out);
+    for (const std::string_view item : items)
+    {
+        appendString(out, item);
+    }
+    endMessage(out);
+}
+
+void EncodeResults(const std::vector<Result>& results, std::string& out)
+{
+    beginMessage(MessageType::kResults, results.size(), out);
+    for (const Result& result : results)
+    {
+        appendPod(out, result.status);
+        appendString(out, result.value);
+    }
+    endMessage(out);
+}
+
+bool DecodeRequest(const Header& header,
+                   std::string_view payload,
+                   std::vector<std::string_view>& items)
+{
+    items.clear();
+    // Each item has at least a size prefix, so a larger count can't be
+    // satisfied, and mustn't be allocated for.
+    if (header.count > payload.size() / sizeof(std::uint32_t))
+    {
+        return false;
+    }
+    items.reserve(header.count);
+    for (std::uint32_t idx = 0; idx < header.count; ++idx)
+    {
+        std::string_view item;
+        if (!readString(payload, item))
+        {
+            return false;
+        }
+        items.push_back(item);
+    }
+    return payload.empty();
+}
+
+bool DecodeResults(const Header& header, std::string_view payload, std::vector<Result>& results)
+{
+    if (header.count > payload.size() / (sizeof(Status) + sizeof(std::uint32_t)))
+    {
+        return false;
+    }
+    results.resize(header.count);
+    for (Result& result : results)
+    {
+        std::string_view value;
+        if (!readPod(payload, result.status) || !readString(payload, value))
+        {
+            return false;
+        }
+        result.value.assign(value);
+    }
+    return payload.empty();
+}
+
+#ifndef _WIN32
+bool WriteMessage(const int fd, std::string_view message)
+{
+    while (!message.empty())
+    {
+        // MSG_NOSIGNAL: report a dead peer as an error, not SIGPIPE.
+        const ssize_t sent = ::send(fd, message.data(), message.size(), MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (sent <= 0)
+        {
+            return false;
+        }
+        message.remove_prefix(static_cast<std::size_t>(sent));
+    }
+    return true;
+}
+
+bool ReadMessage(const int fd, Header& header, std::string& payload)
+{
+    if (!readAll(fd, reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != kMagic || header.version != kVersion ||
+        header.payloadSize > kMaxPayloadSize)
+    {
+        return false;
+    }
+    payload.resize(header.payloadSize);
+    return readAll(fd, payload.data(), payload.size());
+}
+
+std::string DefaultSocketPath()
+{
+    if (const auto runtimeDir = Environment::GetString("XDG_RUNTIME_DIR"))
+    {
+        return *runtimeDir + "/katanaopenassetio-resolverd.sock";
+    }
+    return "/tmp/katanaopenassetio-" + std::to_string(::geteuid()) + "/resolverd.sock";
+}
+
+bool IsPeerCurrentUser(const int fd)
+{
+#ifdef __linux__
+    ucred credentials{};
+    socklen_t size = sizeof(credentials);
+    return ::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &size) == 0 &&
+           credentials.uid == ::geteuid();
+#else
+    uid_t uid = 0;
+    gid_t gid = 0;
+    return ::getpeereid(fd, &uid, &gid) == 0 && uid == ::geteuid();
+#endif
+}
+#else
+bool WriteMessage(int, std::string_view)
+{
+    return false;
+}
+
+bool ReadMessage(int, Header&, std::string&)
+{
+    return false;
+}
+
+std::string DefaultSocketPath()
+{
+    return {};
+}
+
+bool IsPeerCurrentUser(int)
+{
+    return false;
+}
+#endif
+}  // namespace ResolverProtocol
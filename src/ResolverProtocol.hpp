@@ -0,0 +1,98 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Wire format spoken between the plugin and the resolver daemon over a
+ * Unix domain socket.
+ *
+ * Every message is a fixed-size `Header` followed by `count`
+ * length-prefixed items. Requests carry asset IDs; responses carry one
+ * status byte and a string (the result, or an error message) per
+ * requested asset ID, in request order. Both ends are on the same
+ * host, so integers are sent in native byte order.
+ */
+namespace ResolverProtocol
+{
+constexpr std::uint32_t kMagic = 0x52414F4B;  // "KOAR"
+constexpr std::uint16_t kVersion = 3;
+// Guard against allocating absurd buffers on a corrupt stream.
+constexpr std::uint32_t kMaxPayloadSize = 64U * 1024U * 1024U;
+
+enum class MessageType : std::uint16_t
+{
+    // Request: asset IDs. Response: resolved file system paths.
+    kResolveLocations = 1,
+    // Request: no items. Response: no items. Clears the daemon's cache.
+    kFlush = 2,
+    // Response to any request.
+    kResults = 3,
+    // Request: no items. Response: the manager's entity reference
+    // prefix, or an error if it doesn't have one.
+    kEntityReferencePrefix = 4,
+};
+
+enum class Status : std::uint8_t
+{
+    kOk = 0,
+    kError = 1,
+    // Resolved, but the asset ID is to a meta-version, or no version,
+    // so may resolve differently once another version is published,
+    // and mustn't be cached.
+    kOkVolatile = 2,
+};
+
+struct Header
+{
+    std::uint32_t magic;
+    std::uint16_t version;
+    MessageType type;
+    std::uint32_t count;
+    std::uint32_t payloadSize;
+};
+
+struct Result
+{
+    Status status{Status::kError};
+    std::string value;
+};
+
+// Serialises a request containing the given items.
+void EncodeRequest(MessageType type, const std::vector<std::string_view>& items, std::string& out);
+
+// Serialises a response containing the given results.
+void EncodeResults(const std::vector<Result>& results, std::string& out);
+
+// Parses `count` strings from a request payload. Returns false if the
+// payload is malformed.
+bool DecodeRequest(const Header& header,
+                   std::string_view payload,
+                   std::vector<std::string_view>& items);
+
+// Parses `count` results from a response payload. Returns false if the
+// payload is malformed.
+bool DecodeResults(const Header& header, std::string_view payload, std::vector<Result>& results);
+
+// Writes a whole encoded message. Returns false on I/O error.
+bool WriteMessage(int fd, std::string_view message);
+
+// Reads a whole message, validating the header. Returns false on I/O
+// error, disconnection or a malformed header.
+bool ReadMessage(int fd, Header& header, std::string& payload);
+
+// Socket path used by the daemon if none is configured: in
+// $XDG_RUNTIME_DIR if set, otherwise in a per-user directory under
+// /tmp, which only that user may access.
+std::string DefaultSocketPath();
+
+// Returns whether the peer of a connected socket runs as the current
+// user. Connections to or from anyone else should be refused.
+bool IsPeerCurrentUser(int fd);
+}  // namespace ResolverProtocol
@@ -0,0 +1,22 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ScopedGilRelease.hpp"
+
+#include "PythonBridge.hpp"
+
+ScopedGilRelease::ScopedGilRelease()
+{
+    if (const PythonBridge::Functions* python = PythonBridge::LoadedFunctions())
+    {
+        _threadState = python->releaseGil();
+    }
+}
+
+ScopedGilRelease::~ScopedGilRelease()
+{
+    if (_threadState != nullptr)
+    {
+        PythonBridge::LoadedFunctions()->restoreGil(_threadState);
+    }
+}
@@ -0,0 +1,26 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+/**
+ * Releases the Python GIL, if held by the current thread, for the
+ * lifetime of the object.
+ *
+ * Used whilst blocking on work that may be done by another thread
+ * calling into a Python manager, which would otherwise deadlock. Does
+ * nothing unless the Python plugin system has been loaded, so that
+ * Python need not be.
+ */
+class ScopedGilRelease
+{
+public:
+    ScopedGilRelease();
+    ~ScopedGilRelease();
+
+    ScopedGilRelease(const ScopedGilRelease&) = delete;
+    ScopedGilRelease& operator=(const ScopedGilRelease&) = delete;
+
+private:
+    void* _threadState{nullptr};
+};
@@ -0,0 +1,381 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "SharedResolveCache.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Environment.hpp"
+
+namespace
+{
+constexpr std::uint64_t kMagic = 0x4348534F49414F4BULL;  // "KOAIOSHC"
+constexpr std::uint32_t kLayoutVersion = 2;
+constexpr std::size_t kHeaderSize = 64;
+constexpr std::size_t kSlotSize = 512;
+constexpr std::size_t kSlotHeaderSize = 40;
+// Maximum number of slots examined per lookup.
+constexpr std::size_t kMaxProbes = 8;
+// Age after which to check whether a slot's writer is still alive.
+constexpr std::uint64_t kStaleLockNs = 1'000'000'000;
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+                  std::atomic<std::uint32_t>::is_always_lock_free,
+              "Shared memory synchronisation requires lock-free atomics");
+
+std::uint64_t hashKey(const std::string_view key)
+{
+    // 64-bit FNV-1a, with a final avalanche so that the low bits used
+    // for slot selection are well mixed.
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char chr : key)
+    {
+        hash ^= static_cast<unsigned char>(chr);
+        hash *= 1099511628211ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    // Zero marks an empty slot.
+    return hash == 0 ? 1 : hash;
+}
+
+#ifndef _WIN32
+std::uint64_t monotonicNowNs()
+{
+    // CLOCK_MONOTONIC is system-wide, so comparable across processes.
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<std::uint64_t>(now.tv_sec) * 1'000'000'000ULL +
+           static_cast<std::uint64_t>(now.tv_nsec);
+}
+#endif
+}  // namespace
+
+struct SharedResolveCache::Slot
+{
+    // Odd whilst the slot is being written.
+    std::atomic<std::uint64_t> sequence;
+    std::atomic<std::uint64_t> lockedAtNs;
+    // Zero if the slot has never been written.
+    std::uint64_t keyHash;
+    std::uint64_t generation;
+    std::uint16_t keySize;
+    std::uint16_t valueSize;
+    // Process ID of the writer, or zero if unlocked.
+    std::atomic<std::uint32_t> lockedBy;
+    // Key followed by value.
+    char data[kSlotSize - kSlotHeaderSize];
+};
+
+struct SharedResolveCache::Segment
+{
+    std::atomic<std::uint64_t> magic;
+    std::atomic<std::uint32_t> layoutVersion;
+    std::atomic<std::uint32_t> slotCount;
+    std::atomic<std::uint64_t> generation;
+
+    Slot* slots()
+    {
+        return reinterpret_cast<Slot*>(reinterpret_cast<char*>(this) + kHeaderSize);
+    }
+};
+
+std::unique_ptr<SharedResolveCache> SharedResolveCache::open(const std::string& name,
+                                                             const std::size_t sizeBytes)
+{
+    static_assert(sizeof(Slot) == kSlotSize);
+    static_assert(sizeof(Segment) <= kHeaderSize);
+
+#ifdef _WIN32
+    (void)name;
+    (void)sizeBytes;
+    return nullptr;
+#else
+    if (name.empty() || sizeBytes < kHeaderSize + kSlotSize * kMaxProbes)
+    {
+        return nullptr;
+    }
+
+    const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat stats{};
+    // If we're first, size the segment. Zero-filled memory is a valid
+    // empty table, so there's no further initialisation to race over.
+    if (::fstat(fd, &stats) != 0 ||
+        (stats.st_size == 0 &&
+         (::ftruncate(fd, static_cast<off_t>(sizeBytes)) != 0 || ::fstat(fd, &stats) != 0)))
+    {
+        ::close(fd);
+        return nullptr;
+    }
+    const auto mappedSize = static_cast<std::size_t>(stats.st_size);
+    void* const mapped = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    // Largest power of two number of slots that fits.
+    std::uint32_t slotCount = 1;
+    while ((static_cast<std::size_t>(slotCount) * 2) * kSlotSize + kHeaderSize <= mappedSize)
+    {
+        slotCount *= 2;
+    }
+
+    auto* const segment = static_cast<Segment*>(mapped);
+    if (segment->magic.load(std::memory_order_acquire) != kMagic)
+    {
+        // Every process computes identical values, so it doesn't matter
+        // who wins.
+        segment->layoutVersion.store(kLayoutVersion, std::memory_order_relaxed);
+        segment->slotCount.store(slotCount, std::memory_order_relaxed);
+        std::uint64_t expected = 0;
+        segment->magic.compare_exchange_strong(expected, kMagic, std::memory_order_release);
+    }
+    if (segment->magic.load(std::memory_order_acquire) != kMagic ||
+        segment->layoutVersion.load(std::memory_order_relaxed) != kLayoutVersion ||
+        segment->slotCount.load(std::memory_order_relaxed) != slotCount)
+    {
+        // Created by an incompatible build.
+        ::munmap(mapped, mappedSize);
+        return nullptr;
+    }
+
+    return std::unique_ptr<SharedResolveCache>{new SharedResolveCache{segment, mappedSize}};
+#endif
+}
+
+std::string SharedResolveCache::defaultSegmentName()
+{
+#ifdef _WIN32
+    return {};
+#else
+    std::string config = Environment::GetString("OPENASSETIO_DEFAULT_CONFIG").value_or("");
+    config += '\n';
+    config += Environment::GetString("OPENASSETIO_PLUGIN_PATH").value_or("");
+
+    char hashHex[17];
+    std::snprintf(hashHex,
+                  sizeof(hashHex),
+                  "%016llx",
+                  static_cast<unsigned long long>(hashKey(config)));
+    return "/katanaopenassetio-" + std::to_string(::getuid()) + "-" + hashHex;
+#endif
+}
+
+SharedResolveCache::SharedResolveCache(Segment* segment, const std::size_t mappedSize)
+    : _segment{segment}, _mappedSize{mappedSize}
+{
+}
+
+SharedResolveCache::~SharedResolveCache()
+{
+#ifndef _WIN32
+    ::munmap(_segment, _mappedSize);
+#endif
+}
+
+bool SharedResolveCache::get(const std::string_view key, std::string& value) const
+{
+    const std::uint64_t hash = hashKey(key);
+    const std::uint64_t generation = _segment->generation.load(std::memory_order_acquire);
+    const std::size_t mask = _segment->slotCount.load(std::memory_order_relaxed) - 1;
+    Slot* const slots = _segment->slots();
+
+    for (std::size_t probe = 0; probe < kMaxProbes; ++probe)
+    {
+        Slot& slot = slots[(hash + probe) & mask];
+        const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) != 0)
+        {
+            // Being written - skip rather than wait.
+            continue;
+        }
+
+        const std::uint64_t slotHash = slot.keyHash;
+        if (slotHash == 0)
+        {
+            // Never written, so the key can't be further along.
+            return false;
+        }
+        const std::size_t keySize = slot.keySize;
+        const std::size_t valueSize = slot.valueSize;
+        if (slotHash != hash || slot.generation != generation || keySize != key.size() ||
+            keySize + valueSize > sizeof(slot.data))
+        {
+            continue;
+        }
+        const bool keyMatches = std::memcmp(slot.data, key.data(), keySize) == 0;
+        if (keyMatches)
+        {
+            value.assign(slot.data + keySize, valueSize);
+        }
+
+        // Discard anything read if a writer got in whilst we were
+        // reading.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+        {
+            continue;
+        }
+        if (keyMatches)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SharedResolveCache::put(const std::string_view key, const std::string_view value)
+{
+#ifdef _WIN32
+    (void)key;
+    (void)value;
+#else
+    if (key.size() + value.size() > sizeof(Slot::data))
+    {
+        return;
+    }
+
+    const std::uint64_t hash = hashKey(key);
+    const std::uint64_t generation = _segment->generation.load(std::memory_order_acquire);
+    const std::size_t mask = _segment->slotCount.load(std::memory_order_relaxed) - 1;
+    Slot* const slots = _segment->slots();
+
+    // Prefer an empty slot, a stale slot, or our own previous entry.
+    // Failing that, evict a pseudo-randomly chosen slot.
+    const std::size_t victimProbe = (hash >> 48) % kMaxProbes;
+    Slot* target = nullptr;
+    for (std::size_t probe = 0; probe < kMaxProbes && target == nullptr; ++probe)
+    {
+        Slot& slot = slots[(hash + probe) & mask];
+        const bool usable = slot.lockedBy.load(std::memory_order_relaxed) != 0 ||
+                            slot.keyHash == 0 || slot.generation != generation ||
+                            slot.keyHash == hash || probe == victimProbe;
+        if (usable && tryLock(slot))
+        {
+            target = &slot;
+        }
+    }
+    if (target == nullptr)
+    {
+        // Everything contended - sharing is best-effort, so give up.
+        return;
+    }
+
+    const std::uint64_t sequence = beginWrite(*target);
+    target->keyHash = hash;
+    target->generation = generation;
+    target->keySize = static_cast<std::uint16_t>(key.size());
+    target->valueSize = static_cast<std::uint16_t>(value.size());
+    std::memcpy(target->data, key.data(), key.size());
+    std::memcpy(target->data + key.size(), value.data(), value.size());
+
+    // Only the lock holder modifies the sequence, so no need to CAS.
+    target->sequence.store(sequence + 1, std::memory_order_release);
+    target->lockedBy.store(0, std::memory_order_release);
+#endif
+}
+
+void SharedResolveCache::erase(const std::string_view key)
+{
+#ifdef _WIN32
+    (void)key;
+#else
+    const std::uint64_t hash = hashKey(key);
+    const std::uint64_t generation = _segment->generation.load(std::memory_order_acquire);
+    const std::size_t mask = _segment->slotCount.load(std::memory_order_relaxed) - 1;
+    Slot* const slots = _segment->slots();
+
+    for (std::size_t probe = 0; probe < kMaxProbes; ++probe)
+    {
+        Slot& slot = slots[(hash + probe) & mask];
+        if (slot.keyHash == 0)
+        {
+            return;
+        }
+        if (slot.keyHash != hash || !tryLock(slot))
+        {
+            continue;
+        }
+        // Now locked, so the slot can't change under us.
+        const bool matches = slot.keyHash == hash && slot.generation == generation &&
+                             slot.keySize == key.size() &&
+                             slot.keySize + slot.valueSize <= sizeof(slot.data) &&
+                             std::memcmp(slot.data, key.data(), key.size()) == 0;
+        if (matches)
+        {
+            // Stale, rather than empty, so as not to cut short the
+            // probe sequences of other keys.
+            const std::uint64_t sequence = beginWrite(slot);
+            slot.generation = generation - 1;
+            slot.sequence.store(sequence + 1, std::memory_order_release);
+        }
+        slot.lockedBy.store(0, std::memory_order_release);
+        if (matches)
+        {
+            return;
+        }
+    }
+#endif
+}
+
+void SharedResolveCache::invalidate()
+{
+    _segment->generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+#ifndef _WIN32
+bool SharedResolveCache::tryLock(Slot& slot)
+{
+    const auto self = static_cast<std::uint32_t>(::getpid());
+    std::uint32_t owner = 0;
+    if (!slot.lockedBy.compare_exchange_strong(owner, self, std::memory_order_acquire))
+    {
+        // Take over only if the writer has died. One that has merely
+        // stalled could otherwise resume writing over our entry after
+        // we publish it, and readers would accept the result.
+        if (monotonicNowNs() - slot.lockedAtNs.load(std::memory_order_relaxed) < kStaleLockNs ||
+            ::kill(static_cast<pid_t>(owner), 0) == 0 || errno != ESRCH ||
+            !slot.lockedBy.compare_exchange_strong(owner, self, std::memory_order_acquire))
+        {
+            return false;
+        }
+    }
+    slot.lockedAtNs.store(monotonicNowNs(), std::memory_order_relaxed);
+    return true;
+}
+
+std::uint64_t SharedResolveCache::beginWrite(Slot& slot)
+{
+    // Already odd if a dead writer left the slot mid-write.
+    std::uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    if ((sequence & 1) == 0)
+    {
+        slot.sequence.store(++sequence, std::memory_order_relaxed);
+        // Readers must see the slot as being written before any
+        // subsequent writes.
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+    return sequence;
+}
+#endif
@@ -0,0 +1,100 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * Resolve cache shared by all processes on a host, via a POSIX
+ * shared memory segment.
+ *
+ * The segment holds a fixed-capacity, open-addressed hash table of
+ * fixed-size slots. Each slot is guarded by a sequence lock, so
+ * readers never block or take locks; they retry or skip a slot that
+ * is being written. Writers lock a single slot at a time.
+ *
+ * Crash safety:
+ *  - Entries are stamped with the segment's generation, and bumping
+ *    the generation (`invalidate()`) logically empties the table
+ *    without touching any slot.
+ *  - A slot left locked by a writer that died mid-write is reclaimed
+ *    by the next writer once the lock is older than a timeout and the
+ *    writer's process no longer exists. Until then readers treat it as
+ *    a miss. A writer that is merely slow keeps its lock, so cannot
+ *    overwrite an entry published by another.
+ *  - A zero-filled segment is a valid empty table, so a process dying
+ *    whilst creating the segment leaves it usable.
+ *
+ * Entries whose key and value don't fit in a slot are not shared.
+ */
+class SharedResolveCache
+{
+public:
+    /**
+     * Open, or create, the named segment.
+     *
+     * @param name Segment name, which should identify the manager
+     * configuration, such that processes configured differently don't
+     * share results.
+     * @param sizeBytes Segment size, used if creating the segment.
+     *
+     * @return The cache, or null if shared memory is unavailable or
+     * the existing segment has an incompatible layout.
+     */
+    static std::unique_ptr<SharedResolveCache> open(const std::string& name,
+                                                    std::size_t sizeBytes);
+
+    /**
+     * Segment name for the current user and manager configuration,
+     * as given by OPENASSETIO_DEFAULT_CONFIG and
+     * OPENASSETIO_PLUGIN_PATH.
+     */
+    static std::string defaultSegmentName();
+
+    ~SharedResolveCache();
+
+    SharedResolveCache(const SharedResolveCache&) = delete;
+    SharedResolveCache& operator=(const SharedResolveCache&) = delete;
+
+    /**
+     * Look up a value.
+     *
+     * @return Whether the key was found, in which case `value` is set.
+     */
+    bool get(std::string_view key, std::string& value) const;
+
+    /**
+     * Publish a value, replacing any existing value for the key.
+     */
+    void put(std::string_view key, std::string_view value);
+
+    /**
+     * Remove any value for the key, for every process sharing the
+     * segment.
+     */
+    void erase(std::string_view key);
+
+    /**
+     * Invalidate all entries, for every process sharing the segment.
+     */
+    void invalidate();
+
+private:
+    struct Segment;
+    struct Slot;
+
+    SharedResolveCache(Segment* segment, std::size_t mappedSize);
+
+    // Lock a slot for writing, returning whether we now own it.
+    static bool tryLock(Slot& slot);
+    // Mark a locked slot as being written.
+    static std::uint64_t beginWrite(Slot& slot);
+
+    Segment* _segment;
+    std::size_t _mappedSize;
+};
@@ -0,0 +1,91 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "StaleWhileRevalidate.hpp"
+
+#include <exception>
+#include <utility>
+
+#include "ScopedGilRelease.hpp"
+
+StaleWhileRevalidate::StaleWhileRevalidate(const std::chrono::milliseconds deadline,
+                                           const std::size_t numThreads)
+    : _deadline{deadline}, _pool{numThreads}
+{
+}
+
+std::optional<StaleWhileRevalidate::Values> StaleWhileRevalidate::fetch(const std::string& key,
+                                                                         const Fetch& fetch,
+                                                                         const bool haveStale)
+{
+    InFlight inFlight;
+    {
+        const std::lock_guard lock{_mutex};
+        if (const auto inFlightIt = _inFlight.find(key); inFlightIt != _inFlight.end())
+        {
+            inFlight = inFlightIt->second;
+        }
+        else if (haveStale)
+        {
+            auto promise = std::make_shared<std::promise<Values>>();
+            inFlight.result = promise->get_future().share();
+            inFlight.abandoned = std::make_shared<std::atomic<bool>>(false);
+            // Added whilst holding the lock, so the fetch cannot finish
+            // (and remove it) first.
+            _inFlight.emplace(key, inFlight);
+            _pool.post(
+                [this, key, fetch, inFlight, promise = std::move(promise)]
+                {
+                    try
+                    {
+                        Values values = fetch();
+                        finish(key, inFlight, true);
+                        promise->set_value(std::move(values));
+                    }
+                    catch (...)
+                    {
+                        finish(key, inFlight, false);
+                        promise->set_exception(std::current_exception());
+                    }
+                });
+        }
+    }
+
+    if (!inFlight.result.valid())
+    {
+        // Nothing in flight, and nothing to fall back on, so avoid the
+        // hand-off to the pool.
+        return fetch();
+    }
+
+    const ScopedGilRelease gilRelease;
+    if (haveStale &&
+        inFlight.result.wait_for(_deadline) != std::future_status::ready)
+    {
+        inFlight.abandoned->store(true, std::memory_order_relaxed);
+        _staleServes.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+    return inFlight.result.get();
+}
+
+StaleWhileRevalidate::Counters StaleWhileRevalidate::counters() const
+{
+    return {_staleServes.load(std::memory_order_relaxed),
+            _refreshes.load(std::memory_order_relaxed),
+            _refreshFailures.load(std::memory_order_relaxed)};
+}
+
+void StaleWhileRevalidate::finish(const std::string& key,
+                                  const InFlight& inFlight,
+                                  const bool succeeded)
+{
+    {
+        const std::lock_guard lock{_mutex};
+        _inFlight.erase(key);
+    }
+    if (inFlight.abandoned->load(std::memory_order_relaxed))
+    {
+        (succeeded ? _refreshes : _refreshFailures).fetch_add(1, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,97 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+/**
+ * Bounds the latency of manager queries for which a stale value is
+ * available.
+ *
+ * A query is run on a background pool, and waited on for at most the
+ * deadline. If it has not completed by then, the caller serves its
+ * stale value, and the query continues in the background, refreshing
+ * whatever cache the fetch function populates. Concurrent queries for
+ * the same key share a single fetch.
+ *
+ * If no stale value is available, there is nothing better to return,
+ * so the caller waits for the fetch to complete.
+ */
+class StaleWhileRevalidate
+{
+public:
+    /// Values produced by a fetch, e.g. one per requested field.
+    using Values = std::vector<std::string>;
+    /// Queries the manager. Should also populate the cache from which
+    /// stale values are served.
+    using Fetch = std::function<Values()>;
+
+    struct Counters
+    {
+        /// Calls that served a stale value, since the deadline passed.
+        std::uint64_t staleServes;
+        /// Fetches completed in the background after the deadline.
+        std::uint64_t refreshes;
+        /// Fetches that failed in the background after the deadline.
+        std::uint64_t refreshFailures;
+    };
+
+    StaleWhileRevalidate(std::chrono::milliseconds deadline, std::size_t numThreads);
+
+    /**
+     * Run a fetch, or join one already in flight for the same key.
+     *
+     * @param key Identifies the query, for coalescing concurrent
+     * fetches. Must encode everything the fetch depends on.
+     * @param fetch Function to query the manager.
+     * @param haveStale Whether the caller has a stale value to serve if
+     * the deadline passes.
+     *
+     * @return The fetched values, or nullopt if `haveStale` and the
+     * deadline passed, in which case the caller should serve its stale
+     * value.
+     *
+     * @throws Any exception thrown by the fetch, if waited on.
+     */
+    std::optional<Values> fetch(const std::string& key, const Fetch& fetch, bool haveStale);
+
+    [[nodiscard]] Counters counters() const;
+
+    [[nodiscard]] std::chrono::milliseconds deadline() const { return _deadline; }
+
+private:
+    struct InFlight
+    {
+        std::shared_future<Values> result;
+        // Set once any caller has stopped waiting for the result.
+        std::shared_ptr<std::atomic<bool>> abandoned;
+    };
+
+    void finish(const std::string& key, const InFlight& inFlight, bool succeeded);
+
+    const std::chrono::milliseconds _deadline;
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, InFlight> _inFlight;
+
+    std::atomic<std::uint64_t> _staleServes{0};
+    std::atomic<std::uint64_t> _refreshes{0};
+    std::atomic<std::uint64_t> _refreshFailures{0};
+
+    // Last, so that workers are stopped before the above is destroyed.
+    ThreadPool _pool;
+};
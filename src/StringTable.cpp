@@ -0,0 +1,530 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "StringTable.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+namespace
+{
+// Arena block size. Most suffixes are a single path component, so
+// this amortises allocations over thousands of strings.
+constexpr std::size_t kBlockSize = 64 * 1024;
+constexpr std::size_t kInitialIndexCapacity = 1024;
+// Entries locate their suffix by block index, above this many bits of
+// offset into the block.
+constexpr std::uint32_t kBlockShift = 16;
+constexpr std::size_t kMaxBlocks = std::size_t{1} << (32 - kBlockShift);
+
+constexpr std::uint32_t kHashBasis = 2166136261U;
+
+// One step of 32-bit FNV-1a. Being incremental, the hash of each
+// prefix of a string is found on the way to that of the whole string.
+std::uint32_t hashStep(const std::uint32_t hash, const char chr)
+{
+    return (hash ^ static_cast<unsigned char>(chr)) * 16777619U;
+}
+
+std::uint32_t hashString(const std::string_view str)
+{
+    std::uint32_t hash = kHashBasis;
+    for (const char chr : str)
+    {
+        hash = hashStep(hash, chr);
+    }
+    return hash;
+}
+
+bool isSeparator(const char chr)
+{
+    return chr == '/' || chr == '\\';
+}
+}  // namespace
+
+StringTable::StringTable() : _index(kInitialIndexCapacity, kInvalidHandle) {}
+
+StringTable::Handle StringTable::intern(const std::string_view str)
+{
+    const std::uint32_t hash = hashString(str);
+    {
+        const std::shared_lock lock{_mutex};
+        Handle spanning = kInvalidHandle;
+        if (const Handle handle = lookupLocked(str, hash, spanning); handle != kInvalidHandle)
+        {
+            return handle;
+        }
+    }
+    const std::unique_lock lock{_mutex};
+    return internLocked(str, hash);
+}
+
+StringTable::Handle StringTable::find(const std::string_view str) const
+{
+    const std::uint32_t hash = hashString(str);
+    const std::shared_lock lock{_mutex};
+    Handle spanning = kInvalidHandle;
+    return lookupLocked(str, hash, spanning);
+}
+
+std::string StringTable::str(const Handle handle) const
+{
+    std::string result;
+    appendTo(handle, result);
+    return result;
+}
+
+void StringTable::appendTo(const Handle handle, std::string& out) const
+{
+    const std::shared_lock lock{_mutex};
+    appendToLocked(handle, out);
+}
+
+std::size_t StringTable::size() const
+{
+    const std::shared_lock lock{_mutex};
+    return _entries.size();
+}
+
+std::size_t StringTable::memoryUsage() const
+{
+    const std::shared_lock lock{_mutex};
+    return _entries.capacity() * sizeof(Entry) + _index.capacity() * sizeof(Handle) +
+           _blocks.capacity() * sizeof(decltype(_blocks)::value_type) + _arenaBytes;
+}
+
+std::size_t StringTable::baseUsage()
+{
+    return sizeof(Entry) + kInitialIndexCapacity * sizeof(Handle) +
+           sizeof(decltype(_blocks)::value_type) + kBlockSize;
+}
+
+void StringTable::clear()
+{
+    const std::unique_lock lock{_mutex};
+    // Swap rather than clear, so that memory is actually released.
+    std::vector<Entry>{}.swap(_entries);
+    std::vector<Handle>(kInitialIndexCapacity, kInvalidHandle).swap(_index);
+    _numRecords = 0;
+    std::vector<std::unique_ptr<char[]>>{}.swap(_blocks);
+    _currentBlock = 0;
+    _cursor = 0;
+    _remaining = 0;
+    _arenaBytes = 0;
+}
+
+std::vector<StringTable::Handle> StringTable::retain(const std::vector<Handle>& handles)
+{
+    const std::unique_lock lock{_mutex};
+
+    // Mark the strings to keep, along with the prefixes they share.
+    std::vector<Handle> remap(_entries.size(), kInvalidHandle);
+    std::size_t numLive = 0;
+    for (Handle handle : handles)
+    {
+        for (; handle < remap.size() && remap[handle] == kInvalidHandle;
+             handle = _entries[handle].parent)
+        {
+            remap[handle] = 0;
+            ++numLive;
+        }
+    }
+
+    // Copy the survivors into a fresh arena, each after its parent, so
+    // that the parent's new handle is known by the time it is reached.
+    std::vector<Entry> entries;
+    entries.reserve(numLive);
+    std::vector<std::unique_ptr<char[]>> oldBlocks;
+    oldBlocks.swap(_blocks);
+    _currentBlock = 0;
+    _cursor = 0;
+    _remaining = 0;
+    _arenaBytes = 0;
+    for (const Handle handle : parentsFirstLocked())
+    {
+        if (remap[handle] == kInvalidHandle)
+        {
+            continue;
+        }
+        const Entry& entry = _entries[handle];
+        const char* data = oldBlocks[entry.suffix >> kBlockShift].get() +
+                           (entry.suffix & ((1U << kBlockShift) - 1));
+        remap[handle] = static_cast<Handle>(entries.size());
+        entries.push_back({storeSuffix({data, entry.suffixLength}),
+                           entry.parent == kInvalidHandle ? kInvalidHandle : remap[entry.parent],
+                           entry.suffixLength});
+    }
+    oldBlocks.clear();
+    _entries.swap(entries);
+
+    rebuildIndexLocked(kInitialIndexCapacity);
+    return remap;
+}
+
+StringTable::Handle StringTable::lookupLocked(const std::string_view str,
+                                              const std::uint32_t hash,
+                                              Handle& spanning) const
+{
+    // A string is either interned, or spanned by at most one entry, so
+    // the first record that matches is the only one.
+    const std::size_t mask = _index.size() - 1;
+    for (std::size_t slot = hash & mask; _index[slot] != kInvalidHandle; slot = (slot + 1) & mask)
+    {
+        const Handle record = _index[slot];
+        if ((record & kPrefixRecord) == 0)
+        {
+            if (equalsLocked(record, str))
+            {
+                return record;
+            }
+        }
+        else if (spansLocked(record & ~kPrefixRecord, str))
+        {
+            spanning = record & ~kPrefixRecord;
+            return kInvalidHandle;
+        }
+    }
+    return kInvalidHandle;
+}
+
+StringTable::Handle StringTable::internLocked(const std::string_view str, const std::uint32_t hash)
+{
+    // Another thread may have interned the string whilst we were
+    // waiting for the exclusive lock. Or it may be a prefix of a string
+    // already interned, so need only be split off.
+    Handle spanning = kInvalidHandle;
+    if (const Handle handle = lookupLocked(str, hash, spanning); handle != kInvalidHandle)
+    {
+        return handle;
+    }
+
+    // Up to two entries are added, one for a shared prefix.
+    if (str.size() > std::numeric_limits<std::uint32_t>::max() ||
+        _entries.size() + 2 > static_cast<std::size_t>(kPrefixRecord))
+    {
+        throw std::length_error{"StringTable capacity exceeded"};
+    }
+    if (spanning != kInvalidHandle)
+    {
+        return splitLocked(spanning, str.size(), hash);
+    }
+
+    _prefixes.clear();
+    std::uint32_t prefixHash = kHashBasis;
+    for (std::size_t pos = 0; pos < str.size(); ++pos)
+    {
+        if (pos > 0 && isSeparator(str[pos]))
+        {
+            _prefixes.emplace_back(pos, prefixHash);
+        }
+        prefixHash = hashStep(prefixHash, str[pos]);
+    }
+
+    // Share the longest prefix that is either interned or part of a
+    // string that is, in which case it is split off that string.
+    Handle parent = kInvalidHandle;
+    std::size_t parentLength = 0;
+    for (auto prefixIt = _prefixes.rbegin(); prefixIt != _prefixes.rend(); ++prefixIt)
+    {
+        const auto [length, hashOfPrefix] = *prefixIt;
+        parent = lookupLocked(str.substr(0, length), hashOfPrefix, spanning);
+        if (parent == kInvalidHandle && spanning != kInvalidHandle)
+        {
+            parent = splitLocked(spanning, length, hashOfPrefix);
+        }
+        if (parent != kInvalidHandle)
+        {
+            parentLength = length;
+            break;
+        }
+    }
+
+    const auto handle = static_cast<Handle>(_entries.size());
+    const std::string_view suffix = str.substr(parentLength);
+    _entries.push_back({storeSuffix(suffix), parent, static_cast<std::uint32_t>(suffix.size())});
+
+    // Record the prefixes within the suffix, such that a later string
+    // sharing one can split it off.
+    const auto firstPrefix = std::upper_bound(
+        _prefixes.begin(),
+        _prefixes.end(),
+        parentLength,
+        [](const std::size_t length, const auto& prefix) { return length < prefix.first; });
+    _numRecords += 1 + static_cast<std::size_t>(_prefixes.end() - firstPrefix);
+    if (_numRecords * 10 > _index.size() * 7)
+    {
+        rebuildIndexLocked(_index.size() * 2);
+    }
+    else
+    {
+        insertRecordLocked(handle, hash);
+        for (auto prefixIt = firstPrefix; prefixIt != _prefixes.end(); ++prefixIt)
+        {
+            insertRecordLocked(handle | kPrefixRecord, prefixIt->second);
+        }
+    }
+    return handle;
+}
+
+StringTable::Handle StringTable::splitLocked(const Handle handle,
+                                             const std::size_t prefixLength,
+                                             const std::uint32_t hash)
+{
+    // Find the entry whose suffix spans the end of the prefix.
+    std::size_t end = 0;
+    for (Handle ancestor = handle; ancestor != kInvalidHandle;
+         ancestor = _entries[ancestor].parent)
+    {
+        end += _entries[ancestor].suffixLength;
+    }
+    Handle spanning = handle;
+    while (end - _entries[spanning].suffixLength >= prefixLength)
+    {
+        end -= _entries[spanning].suffixLength;
+        spanning = _entries[spanning].parent;
+    }
+
+    // The new entry takes the leading part of the suffix, in place.
+    Entry& entry = _entries[spanning];
+    const auto headLength =
+        static_cast<std::uint32_t>(prefixLength - (end - entry.suffixLength));
+    const Entry head{entry.suffix, entry.parent, headLength};
+    const auto prefix = static_cast<Handle>(_entries.size());
+    const std::uint32_t offset = (entry.suffix & ((1U << kBlockShift) - 1)) + headLength;
+    if (offset < (1U << kBlockShift))
+    {
+        entry.suffix += headLength;
+    }
+    else
+    {
+        // Beyond the offset bits, within an oversized block.
+        entry.suffix =
+            storeSuffix({suffixData(entry) + headLength, entry.suffixLength - headLength});
+    }
+    entry.suffixLength -= headLength;
+    entry.parent = prefix;
+    _entries.push_back(head);
+
+    // The prefix's record within the split entry is left in place, as
+    // it no longer matches the prefix, but may match others within the
+    // same entry, until the index is next rebuilt.
+    addRecordLocked(prefix, hash);
+    return prefix;
+}
+
+bool StringTable::equalsLocked(Handle handle, std::string_view str) const
+{
+    // Compare trailing components, walking up the prefix chain.
+    while (true)
+    {
+        const Entry& entry = _entries[handle];
+        if (entry.suffixLength > str.size())
+        {
+            return false;
+        }
+        const std::size_t prefixLength = str.size() - entry.suffixLength;
+        if (std::memcmp(str.data() + prefixLength, suffixData(entry), entry.suffixLength) != 0)
+        {
+            return false;
+        }
+        if (entry.parent == kInvalidHandle)
+        {
+            return prefixLength == 0;
+        }
+        str = str.substr(0, prefixLength);
+        handle = entry.parent;
+    }
+}
+
+bool StringTable::spansLocked(const Handle handle, const std::string_view str) const
+{
+    // Whether `str` is a prefix of the handle's string, ending before a
+    // path separator within the suffix of an entry in its chain, rather
+    // than at the end of one.
+    std::size_t end = 0;
+    for (Handle ancestor = handle; ancestor != kInvalidHandle;
+         ancestor = _entries[ancestor].parent)
+    {
+        end += _entries[ancestor].suffixLength;
+    }
+    if (end <= str.size())
+    {
+        return false;
+    }
+    for (Handle ancestor = handle; ancestor != kInvalidHandle;
+         ancestor = _entries[ancestor].parent)
+    {
+        const Entry& entry = _entries[ancestor];
+        const std::size_t start = end - entry.suffixLength;
+        if (start == str.size())
+        {
+            return false;
+        }
+        if (start < str.size())
+        {
+            const char* data = suffixData(entry);
+            if (end > str.size() && !isSeparator(data[str.size() - start]))
+            {
+                return false;
+            }
+            if (std::memcmp(str.data() + start, data, std::min(end, str.size()) - start) != 0)
+            {
+                return false;
+            }
+        }
+        end = start;
+    }
+    return true;
+}
+
+void StringTable::appendToLocked(Handle handle, std::string& out) const
+{
+    if (handle >= _entries.size())
+    {
+        throw std::out_of_range{"Invalid StringTable handle"};
+    }
+    // Lengths aren't stored, so measure the chain first, then fill
+    // from the back so that no intermediate buffer is required.
+    std::size_t end = out.size();
+    for (Handle ancestor = handle; ancestor != kInvalidHandle;
+         ancestor = _entries[ancestor].parent)
+    {
+        end += _entries[ancestor].suffixLength;
+    }
+    out.resize(end);
+    while (handle != kInvalidHandle)
+    {
+        const Entry& entry = _entries[handle];
+        end -= entry.suffixLength;
+        std::memcpy(out.data() + end, suffixData(entry), entry.suffixLength);
+        handle = entry.parent;
+    }
+}
+
+const char* StringTable::suffixData(const Entry& entry) const
+{
+    return _blocks[entry.suffix >> kBlockShift].get() +
+           (entry.suffix & ((1U << kBlockShift) - 1));
+}
+
+std::uint32_t StringTable::storeSuffix(const std::string_view suffix)
+{
+    const bool oversized = suffix.size() > kBlockSize / 4;
+    if ((oversized || suffix.size() >= _remaining) && _blocks.size() >= kMaxBlocks)
+    {
+        throw std::length_error{"StringTable capacity exceeded"};
+    }
+    if (oversized)
+    {
+        // Oversized - give it a dedicated block, leaving the current
+        // block available for subsequent small suffixes.
+        _blocks.push_back(std::make_unique<char[]>(suffix.size()));
+        _arenaBytes += suffix.size();
+        std::memcpy(_blocks.back().get(), suffix.data(), suffix.size());
+        return static_cast<std::uint32_t>(_blocks.size() - 1) << kBlockShift;
+    }
+    // Start a new block before the offset would reach kBlockSize, so
+    // that it always fits the bits reserved for it.
+    if (suffix.size() >= _remaining)
+    {
+        _blocks.push_back(std::make_unique<char[]>(kBlockSize));
+        _arenaBytes += kBlockSize;
+        _currentBlock = static_cast<std::uint32_t>(_blocks.size() - 1);
+        _cursor = 0;
+        _remaining = kBlockSize;
+    }
+    const std::uint32_t location =
+        _currentBlock << kBlockShift | static_cast<std::uint32_t>(_cursor);
+    std::memcpy(_blocks[_currentBlock].get() + _cursor, suffix.data(), suffix.size());
+    _cursor += suffix.size();
+    _remaining -= suffix.size();
+    return location;
+}
+
+std::vector<StringTable::Handle> StringTable::parentsFirstLocked() const
+{
+    // Splitting an entry gives it a parent with a later handle, so
+    // handle order won't do.
+    std::vector<Handle> order;
+    order.reserve(_entries.size());
+    std::vector<bool> placed(_entries.size());
+    std::vector<Handle> chain;
+    for (Handle handle = 0; handle < _entries.size(); ++handle)
+    {
+        for (Handle ancestor = handle; ancestor != kInvalidHandle && !placed[ancestor];
+             ancestor = _entries[ancestor].parent)
+        {
+            placed[ancestor] = true;
+            chain.push_back(ancestor);
+        }
+        order.insert(order.end(), chain.rbegin(), chain.rend());
+        chain.clear();
+    }
+    return order;
+}
+
+void StringTable::addRecordLocked(const Handle record, const std::uint32_t hash)
+{
+    // Keep the load factor below 70%.
+    if (++_numRecords * 10 > _index.size() * 7)
+    {
+        rebuildIndexLocked(_index.size() * 2);
+    }
+    else
+    {
+        insertRecordLocked(record, hash);
+    }
+}
+
+void StringTable::insertRecordLocked(const Handle record, const std::uint32_t hash)
+{
+    const std::size_t mask = _index.size() - 1;
+    std::size_t slot = hash & mask;
+    while (_index[slot] != kInvalidHandle)
+    {
+        slot = (slot + 1) & mask;
+    }
+    _index[slot] = record;
+}
+
+void StringTable::rebuildIndexLocked(const std::size_t minCapacity)
+{
+    // One record per entry, and per prefix within its suffix.
+    _numRecords = _entries.size();
+    for (const Entry& entry : _entries)
+    {
+        const char* data = suffixData(entry);
+        _numRecords += static_cast<std::size_t>(
+            std::count_if(data + std::min(entry.suffixLength, 1U),
+                          data + entry.suffixLength,
+                          isSeparator));
+    }
+    std::size_t capacity = minCapacity;
+    while (_numRecords * 10 > capacity * 7)
+    {
+        capacity *= 2;
+    }
+    std::vector<Handle>(capacity, kInvalidHandle).swap(_index);
+
+    // Hashes aren't stored, so are recomputed from each parent's, which
+    // also yields those of the prefixes within each suffix.
+    std::vector<std::uint32_t> hashes(_entries.size());
+    for (const Handle handle : parentsFirstLocked())
+    {
+        const Entry& entry = _entries[handle];
+        std::uint32_t hash = entry.parent == kInvalidHandle ? kHashBasis : hashes[entry.parent];
+        const char* data = suffixData(entry);
+        for (std::uint32_t pos = 0; pos < entry.suffixLength; ++pos)
+        {
+            if (pos > 0 && isSeparator(data[pos]))
+            {
+                insertRecordLocked(handle | kPrefixRecord, hash);
+            }
+            hash = hashStep(hash, data[pos]);
+        }
+        hashes[handle] = hash;
+        insertRecordLocked(handle, hash);
+    }
+}
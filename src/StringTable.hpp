@@ -0,0 +1,152 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * Thread-safe interning table for strings that share long common
+ * prefixes, such as entity references and file paths.
+ *
+ * Each distinct string is assigned a stable 32-bit handle, so that
+ * callers can hash and compare handles rather than strings.
+ *
+ * Storage is a path trie, compressed such that a string shares the
+ * longest prefix, up to a path separator, that it has in common with
+ * any string already interned, and only the remainder is copied into
+ * an append-only arena. Hence "/shows/foo/shot010/tex/a.exr" and
+ * "/shows/foo/shot010/tex/b.exr" share every byte except their file
+ * names. Prefixes shared by no other string are not split off, so a
+ * string with a unique tail of several path components costs a single
+ * 12-byte entry, locating its bytes by 32-bit arena offset rather than
+ * by pointer. Should a later string share part of that tail, the entry
+ * is split in place, keeping its handle.
+ *
+ * Strings cannot be removed individually, but `retain()` discards all
+ * but a given set, compacting the table and renumbering their handles.
+ * Otherwise, handles remain valid until `clear()` is called.
+ */
+class StringTable
+{
+public:
+    using Handle = std::uint32_t;
+    static constexpr Handle kInvalidHandle = std::numeric_limits<Handle>::max();
+
+    StringTable();
+
+    /**
+     * Return the handle for the given string, adding it to the table if
+     * not already present.
+     */
+    Handle intern(std::string_view str);
+
+    /**
+     * Return the handle for the given string, or `kInvalidHandle` if it
+     * has not been interned.
+     */
+    [[nodiscard]] Handle find(std::string_view str) const;
+
+    /**
+     * Reconstruct the string for the given handle.
+     */
+    [[nodiscard]] std::string str(Handle handle) const;
+
+    /**
+     * Append the string for the given handle to `out`, avoiding a
+     * temporary allocation where `out` has capacity.
+     */
+    void appendTo(Handle handle, std::string& out) const;
+
+    /**
+     * @return Number of distinct strings interned.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @return Approximate number of bytes held by the table.
+     */
+    [[nodiscard]] std::size_t memoryUsage() const;
+
+    /**
+     * @return Bytes held by a table of a single short string, which
+     * `retain()` cannot release.
+     */
+    static std::size_t baseUsage();
+
+    /**
+     * Remove all strings, invalidating all handles.
+     */
+    void clear();
+
+    /**
+     * Remove all strings other than those given, and their prefixes,
+     * releasing the memory they occupy. This invalidates all handles.
+     *
+     * @param handles Handles of strings to keep. May contain
+     * duplicates and `kInvalidHandle`.
+     *
+     * @return New handle of each string kept, indexed by its previous
+     * handle, or `kInvalidHandle` for those removed.
+     */
+    std::vector<Handle> retain(const std::vector<Handle>& handles);
+
+private:
+    struct Entry
+    {
+        // Arena block index in the top 16 bits, offset in the bottom.
+        std::uint32_t suffix;
+        Handle parent;
+        std::uint32_t suffixLength;
+    };
+
+    // Set on index records standing for a prefix, ending at a path
+    // separator, within the suffix of the entry they refer to.
+    static constexpr Handle kPrefixRecord = Handle{1} << 31;
+
+    // The string's handle if interned, otherwise `kInvalidHandle`, in
+    // which case `spanning` is set to the entry whose suffix spans the
+    // string, if it is a prefix of one.
+    [[nodiscard]] Handle lookupLocked(std::string_view str,
+                                      std::uint32_t hash,
+                                      Handle& spanning) const;
+    Handle internLocked(std::string_view str, std::uint32_t hash);
+    // Split the entry in `handle`'s chain that spans `prefixLength`,
+    // returning the handle of the new entry for the prefix.
+    Handle splitLocked(Handle handle, std::size_t prefixLength, std::uint32_t hash);
+    [[nodiscard]] bool equalsLocked(Handle handle, std::string_view str) const;
+    [[nodiscard]] bool spansLocked(Handle handle, std::string_view str) const;
+    void appendToLocked(Handle handle, std::string& out) const;
+    [[nodiscard]] const char* suffixData(const Entry& entry) const;
+    std::uint32_t storeSuffix(std::string_view suffix);
+    // Handles of all entries, each after its parent.
+    [[nodiscard]] std::vector<Handle> parentsFirstLocked() const;
+    void addRecordLocked(Handle record, std::uint32_t hash);
+    void insertRecordLocked(Handle record, std::uint32_t hash);
+    void rebuildIndexLocked(std::size_t minCapacity);
+
+    mutable std::shared_mutex _mutex;
+    std::vector<Entry> _entries;
+    // Open-addressed hash index of handles into `_entries`, and of
+    // prefixes within their suffixes. Capacity is always a power of
+    // two.
+    std::vector<Handle> _index;
+    // Records in `_index`, including those of prefixes since split off.
+    std::size_t _numRecords{0};
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    // Block being filled by small suffixes, and the offset into it.
+    std::uint32_t _currentBlock{0};
+    std::size_t _cursor{0};
+    std::size_t _remaining{0};
+    std::size_t _arenaBytes{0};
+    // Position and hash of each prefix of the string being interned.
+    std::vector<std::pair<std::size_t, std::uint32_t>> _prefixes;
+};
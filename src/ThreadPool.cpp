@@ -0,0 +1,70 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(const std::size_t numThreads)
+{
+    const std::size_t count = std::max<std::size_t>(numThreads, 1);
+    _threads.reserve(count);
+    for (std::size_t idx = 0; idx < count; ++idx)
+    {
+        _threads.emplace_back([this] { run(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    std::deque<std::function<void()>> discarded;
+    {
+        const std::lock_guard lock{_mutex};
+        _stopping = true;
+        discarded.swap(_tasks);
+    }
+    _cv.notify_all();
+    for (std::thread& thread : _threads)
+    {
+        thread.join();
+    }
+    // Destroyed outside the lock, and after the workers have stopped,
+    // since this may run arbitrary destructors.
+    discarded.clear();
+}
+
+void ThreadPool::post(std::function<void()> task)
+{
+    {
+        const std::lock_guard lock{_mutex};
+        _tasks.push_back(std::move(task));
+    }
+    _cv.notify_one();
+}
+
+bool ThreadPool::isWorkerThread() const
+{
+    const std::thread::id self = std::this_thread::get_id();
+    return std::any_of(_threads.begin(),
+                       _threads.end(),
+                       [self](const std::thread& thread) { return thread.get_id() == self; });
+}
+
+void ThreadPool::run()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock lock{_mutex};
+            _cv.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+            if (_stopping)
+            {
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+        task();
+    }
+}
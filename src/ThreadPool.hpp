@@ -0,0 +1,73 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Fixed-size pool of worker threads executing tasks in FIFO order.
+ *
+ * On destruction, tasks already running are completed, and queued tasks
+ * are discarded, such that any futures for them report a broken
+ * promise.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(std::size_t numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Queue a task for execution on a worker thread. The task must not
+     * throw.
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * Queue a callable for execution on a worker thread.
+     *
+     * @return Future for the callable's result, or the exception it
+     * threw.
+     */
+    template <typename Fn>
+    std::future<std::invoke_result_t<Fn>> submit(Fn&& fn)
+    {
+        // `std::function` must be copyable, so can't hold the task
+        // directly.
+        auto task =
+            std::make_shared<std::packaged_task<std::invoke_result_t<Fn>()>>(std::forward<Fn>(fn));
+        auto future = task->get_future();
+        post([task = std::move(task)] { (*task)(); });
+        return future;
+    }
+
+    [[nodiscard]] std::size_t size() const { return _threads.size(); }
+
+    /**
+     * @return Whether the calling thread is one of the pool's workers.
+     */
+    [[nodiscard]] bool isWorkerThread() const;
+
+private:
+    void run();
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<std::function<void()>> _tasks;
+    bool _stopping{false};
+    std::vector<std::thread> _threads;
+};
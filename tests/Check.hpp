@@ -0,0 +1,47 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * Minimal assertion helpers for the unit tests, which are plain
+ * executables run by CTest. A failed check is reported and the test
+ * continues, exiting non-zero once done.
+ */
+namespace Check
+{
+/// Number of failed checks so far.
+inline int gFailures = 0;
+
+inline void Fail(const char* file, const int line, const char* expr)
+{
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+    ++gFailures;
+}
+
+/**
+ * @return The test's exit status, reporting the number of failures.
+ */
+inline int Result()
+{
+    if (gFailures != 0)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", gFailures);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+}  // namespace Check
+
+/// Check that `expr` is true, recording a failure if not.
+#define KATANAOPENASSETIO_CHECK(expr)               \
+    do                                              \
+    {                                               \
+        if (!(expr))                                \
+        {                                           \
+            Check::Fail(__FILE__, __LINE__, #expr); \
+        }                                           \
+    } while (false)
@@ -0,0 +1,334 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Check.hpp"
+#include "EntityCache.hpp"
+
+namespace
+{
+using Field = EntityCache::Field;
+
+std::string assetId(const int idx)
+{
+    return "ams:///show/seq/shot/asset" + std::to_string(idx);
+}
+
+std::string location(const int idx)
+{
+    return "/mnt/projects/show/seq/shot/asset" + std::to_string(idx) + "/v1/model.abc";
+}
+
+void fill(EntityCache& cache, const int begin, const int end)
+{
+    for (int idx = begin; idx < end; ++idx)
+    {
+        cache.put(assetId(idx), Field::kLocation, location(idx));
+    }
+}
+
+// Check that every value still cached is the one put, returning how
+// many are.
+std::size_t checkSurvivors(const EntityCache& cache, const int begin, const int end)
+{
+    std::size_t numFound = 0;
+    std::string value;
+    for (int idx = begin; idx < end; ++idx)
+    {
+        if (cache.getStale(assetId(idx), Field::kLocation, value))
+        {
+            KATANAOPENASSETIO_CHECK(value == location(idx));
+            ++numFound;
+        }
+    }
+    return numFound;
+}
+
+void testPutAndGet()
+{
+    EntityCache cache;
+    std::string value;
+    KATANAOPENASSETIO_CHECK(!cache.get("ams:///a", Field::kLocation, value));
+
+    cache.put("ams:///a", Field::kLocation, "/mnt/a.abc");
+    cache.put("ams:///a", Field::kDisplayName, "a");
+    KATANAOPENASSETIO_CHECK(cache.size() == 2);
+    KATANAOPENASSETIO_CHECK(cache.get("ams:///a", Field::kLocation, value) && value == "/mnt/a.abc");
+    KATANAOPENASSETIO_CHECK(cache.get("ams:///a", Field::kDisplayName, value) && value == "a");
+    KATANAOPENASSETIO_CHECK(!cache.get("ams:///a", Field::kVersionTag, value));
+
+    cache.put("ams:///a", Field::kLocation, "/mnt/a2.abc");
+    KATANAOPENASSETIO_CHECK(cache.size() == 2);
+    KATANAOPENASSETIO_CHECK(cache.get("ams:///a", Field::kLocation, value) &&
+                            value == "/mnt/a2.abc");
+
+    // Empty values are values.
+    cache.put("ams:///b", Field::kVersionTag, "");
+    KATANAOPENASSETIO_CHECK(cache.get("ams:///b", Field::kVersionTag, value) && value.empty());
+
+    cache.clear();
+    KATANAOPENASSETIO_CHECK(cache.size() == 0);
+    KATANAOPENASSETIO_CHECK(!cache.getStale("ams:///a", Field::kLocation, value));
+}
+
+void testGenerations()
+{
+    EntityCache cache;
+    const EntityCache::Generation initial = cache.generation();
+    KATANAOPENASSETIO_CHECK(cache.put("ams:///a", Field::kLocation, "/mnt/a.abc", initial));
+
+    cache.invalidate();
+    KATANAOPENASSETIO_CHECK(cache.generation() != initial);
+    std::string value;
+    KATANAOPENASSETIO_CHECK(!cache.get("ams:///a", Field::kLocation, value));
+    KATANAOPENASSETIO_CHECK(cache.getStale("ams:///a", Field::kLocation, value) &&
+                            value == "/mnt/a.abc");
+
+    // Values from before the invalidation are refused.
+    KATANAOPENASSETIO_CHECK(!cache.put("ams:///a", Field::kLocation, "/mnt/old.abc", initial));
+    KATANAOPENASSETIO_CHECK(cache.getStale("ams:///a", Field::kLocation, value) &&
+                            value == "/mnt/a.abc");
+    KATANAOPENASSETIO_CHECK(
+        cache.put("ams:///a", Field::kLocation, "/mnt/new.abc", cache.generation()));
+    KATANAOPENASSETIO_CHECK(cache.get("ams:///a", Field::kLocation, value) &&
+                            value == "/mnt/new.abc");
+
+    // Only values that aren't stale are visited.
+    cache.put("ams:///b", Field::kLocation, "/mnt/b.abc");
+    cache.invalidate();
+    cache.put("ams:///c", Field::kLocation, "/mnt/c.abc");
+    std::size_t numVisited = 0;
+    cache.forEach(
+        [&numVisited](const std::string_view visitedId, const Field field, const std::string_view)
+        {
+            KATANAOPENASSETIO_CHECK(visitedId == "ams:///c" && field == Field::kLocation);
+            ++numVisited;
+        });
+    KATANAOPENASSETIO_CHECK(numVisited == 1);
+
+    // Clearing also refuses values from before it.
+    const EntityCache::Generation beforeClear = cache.generation();
+    cache.clear();
+    KATANAOPENASSETIO_CHECK(!cache.put("ams:///a", Field::kLocation, "/mnt/a.abc", beforeClear));
+}
+
+void testInvalidateEntityAndField()
+{
+    EntityCache cache;
+    cache.put("ams:///a", Field::kLocation, "/mnt/a.abc");
+    cache.put("ams:///a", Field::kDisplayName, "a");
+    cache.put("ams:///a", Field::kVersions, "v1\n");
+    cache.put("ams:///b", Field::kLocation, "/mnt/b.abc");
+    cache.put("ams:///b", Field::kVersions, "v1\n");
+
+    // Only the values of the entity are stale.
+    const EntityCache::Generation beforeEntity = cache.generation();
+    cache.invalidate("ams:///a");
+    std::string value;
+    KATANAOPENASSETIO_CHECK(!cache.get("ams:///a", Field::kLocation, value));
+    KATANAOPENASSETIO_CHECK(!cache.get("ams:///a", Field::kDisplayName, value));
+    KATANAOPENASSETIO_CHECK(cache.getStale("ams:///a", Field::kLocation, value) &&
+                            value == "/mnt/a.abc");
+    KATANAOPENASSETIO_CHECK(cache.get("ams:///b", Field::kLocation, value) &&
+                            value == "/mnt/b.abc");
+    // Values fetched before the invalidation are refused.
+    KATANAOPENASSETIO_CHECK(!cache.put("ams:///a", Field::kLocation, "/mnt/old.abc", beforeEntity));
+
+    // Likewise for the values of a field.
+    cache.invalidate(Field::kVersions);
+    KATANAOPENASSETIO_CHECK(!cache.get("ams:///b", Field::kVersions, value));
+    KATANAOPENASSETIO_CHECK(cache.get("ams:///b", Field::kLocation, value) &&
+                            value == "/mnt/b.abc");
+    KATANAOPENASSETIO_CHECK(
+        cache.put("ams:///b", Field::kVersions, "v1\nv2\n", cache.generation()));
+    KATANAOPENASSETIO_CHECK(cache.get("ams:///b", Field::kVersions, value) && value == "v1\nv2\n");
+
+    // Entities with nothing cached are fine.
+    cache.invalidate("ams:///c");
+    KATANAOPENASSETIO_CHECK(cache.get("ams:///b", Field::kLocation, value));
+    KATANAOPENASSETIO_CHECK(cache.size() == 5);
+}
+
+void testDiscardStale()
+{
+    EntityCache cache;
+    fill(cache, 0, 1000);
+    cache.invalidate();
+    fill(cache, 0, 500);
+    // Replaced values are held until compacted.
+    for (int round = 0; round < 10; ++round)
+    {
+        cache.put(assetId(0), Field::kDisplayName, "name" + std::to_string(round));
+    }
+    const std::size_t usageBefore = cache.memoryUsage();
+
+    KATANAOPENASSETIO_CHECK(cache.discardStale() == 500);
+    KATANAOPENASSETIO_CHECK(cache.size() == 501);
+    KATANAOPENASSETIO_CHECK(cache.memoryUsage() < usageBefore);
+    KATANAOPENASSETIO_CHECK(checkSurvivors(cache, 0, 1000) == 500);
+    std::string value;
+    KATANAOPENASSETIO_CHECK(cache.get(assetId(499), Field::kLocation, value) &&
+                            value == location(499));
+    KATANAOPENASSETIO_CHECK(!cache.getStale(assetId(500), Field::kLocation, value));
+    KATANAOPENASSETIO_CHECK(cache.get(assetId(0), Field::kDisplayName, value) &&
+                            value == "name9");
+}
+
+void testShrink()
+{
+    const std::size_t emptyUsage = EntityCache{}.memoryUsage();
+    EntityCache cache;
+    fill(cache, 0, 20000);
+    const std::size_t usage = cache.memoryUsage();
+    KATANAOPENASSETIO_CHECK(usage > emptyUsage);
+
+    const std::size_t target = (usage - emptyUsage) / 2;
+    const std::size_t numEvicted = cache.shrink(target);
+    KATANAOPENASSETIO_CHECK(numEvicted > 0 && numEvicted < 20000);
+    KATANAOPENASSETIO_CHECK(cache.size() == 20000 - numEvicted);
+    KATANAOPENASSETIO_CHECK(cache.memoryUsage() <= emptyUsage + target);
+    KATANAOPENASSETIO_CHECK(checkSurvivors(cache, 0, 20000) == cache.size());
+
+    // The cache remains usable after compaction.
+    fill(cache, 20000, 21000);
+    KATANAOPENASSETIO_CHECK(checkSurvivors(cache, 20000, 21000) == 1000);
+
+    const std::size_t numCached = cache.size();
+    KATANAOPENASSETIO_CHECK(cache.shrink(0) == numCached);
+    KATANAOPENASSETIO_CHECK(cache.size() == 0);
+}
+
+void testEvictsStaleValuesFirst()
+{
+    EntityCache cache;
+    fill(cache, 0, 10000);
+    cache.invalidate();
+    fill(cache, 10000, 12000);
+
+    const std::size_t emptyUsage = EntityCache{}.memoryUsage();
+    cache.shrink((cache.memoryUsage() - emptyUsage) / 2);
+    KATANAOPENASSETIO_CHECK(checkSurvivors(cache, 10000, 12000) == 2000);
+
+    // Survivors keep their generation.
+    std::string value;
+    std::size_t numFresh = 0;
+    for (int idx = 0; idx < 10000; ++idx)
+    {
+        numFresh += cache.get(assetId(idx), Field::kLocation, value) ? 1 : 0;
+    }
+    KATANAOPENASSETIO_CHECK(numFresh == 0);
+}
+
+void testSparesRecentlyUsedValues()
+{
+    EntityCache cache;
+    fill(cache, 0, 10000);
+    const std::size_t emptyUsage = EntityCache{}.memoryUsage();
+
+    // Values start referenced, so a first sweep leaves every survivor
+    // unreferenced.
+    cache.shrink((cache.memoryUsage() - emptyUsage) * 9 / 10);
+
+    std::string value;
+    std::vector<int> touched;
+    for (int idx = 0; idx < 10000 && touched.size() < 100; ++idx)
+    {
+        if (cache.get(assetId(idx), Field::kLocation, value))
+        {
+            touched.push_back(idx);
+        }
+    }
+    KATANAOPENASSETIO_CHECK(touched.size() == 100);
+
+    cache.shrink((cache.memoryUsage() - emptyUsage) / 2);
+    for (const int idx : touched)
+    {
+        KATANAOPENASSETIO_CHECK(cache.get(assetId(idx), Field::kLocation, value));
+    }
+}
+
+void testBudget()
+{
+    // Budgets exclude the tables and first arena block of the string
+    // table, which can't be released whilst any value is cached.
+    EntityCache single;
+    single.put("a", Field::kLocation, "b");
+    const std::size_t emptyUsage = single.memoryUsage();
+    constexpr std::size_t kBudget = 1024 * 1024;
+
+    EntityCache cache;
+    cache.setBudget(kBudget);
+    fill(cache, 0, 100000);
+    // Allow for growth between budget checks.
+    KATANAOPENASSETIO_CHECK(cache.memoryUsage() <= emptyUsage + 2 * kBudget);
+    KATANAOPENASSETIO_CHECK(cache.size() > 0 && cache.size() < 100000);
+    KATANAOPENASSETIO_CHECK(checkSurvivors(cache, 0, 100000) == cache.size());
+
+    cache.trim();
+    KATANAOPENASSETIO_CHECK(cache.memoryUsage() <=
+                            emptyUsage + kBudget * EntityCache::kLowWaterPercent / 100);
+
+    // A budget smaller than an empty cache's tables mustn't evict
+    // everything.
+    EntityCache small;
+    fill(small, 0, 100);
+    small.setBudget(8 * 1024);
+    KATANAOPENASSETIO_CHECK(small.size() > 0);
+
+    // Without a budget, trimming shrinks by the low-water mark.
+    EntityCache unbounded;
+    fill(unbounded, 0, 10000);
+    KATANAOPENASSETIO_CHECK(unbounded.trim() > 0);
+    KATANAOPENASSETIO_CHECK(unbounded.size() > 0);
+}
+
+// Readers race writers whose puts trigger eviction, and must only
+// ever see the value put for the ID they look up.
+void testConcurrentEviction()
+{
+    EntityCache cache;
+    cache.setBudget(256 * 1024);
+    std::atomic<bool> done{false};
+    std::atomic<int> numWrong{0};
+
+    std::thread reader{[&]
+                       {
+                           std::string value;
+                           for (int idx = 0; !done.load(); idx = (idx + 1) % 20000)
+                           {
+                               if (cache.get(assetId(idx), Field::kLocation, value) &&
+                                   value != location(idx))
+                               {
+                                   ++numWrong;
+                               }
+                           }
+                       }};
+    fill(cache, 0, 20000);
+    fill(cache, 0, 20000);
+    done = true;
+    reader.join();
+
+    KATANAOPENASSETIO_CHECK(numWrong.load() == 0);
+    KATANAOPENASSETIO_CHECK(checkSurvivors(cache, 0, 20000) == cache.size());
+}
+}  // namespace
+
+int main()
+{
+    testPutAndGet();
+    testGenerations();
+    testInvalidateEntityAndField();
+    testDiscardStale();
+    testShrink();
+    testEvictsStaleValuesFirst();
+    testSparesRecentlyUsedValues();
+    testBudget();
+    testConcurrentEviction();
+    return Check::Result();
+}
@@ -0,0 +1,191 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// Checks CachingFileUrlPathConverter, and its fast path in particular,
+// against OpenAssetIO's FileUrlPathConverter, which is the reference
+// for both converted paths and which URLs are rejected.
+
+#include <cstdio>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/utils/path.hpp>
+
+#include "Check.hpp"
+#include "FileUrlPathConverter.hpp"
+
+namespace
+{
+// The path OpenAssetIO converts the URL to, or nullopt if it rejects
+// it.
+std::optional<std::string> referencePath(const std::string_view url)
+{
+    static const openassetio::utils::FileUrlPathConverter kConverter;
+    try
+    {
+        return kConverter.pathFromUrl(url);
+    }
+    catch (const openassetio::errors::InputValidationException&)
+    {
+        return std::nullopt;
+    }
+}
+
+std::optional<std::string> convertedPath(CachingFileUrlPathConverter& converter,
+                                         const std::string_view url)
+{
+    try
+    {
+        return converter.pathFromUrl(url);
+    }
+    catch (const openassetio::errors::InputValidationException&)
+    {
+        return std::nullopt;
+    }
+}
+
+// Check the fast path, if it handles the URL, and the full conversion
+// (twice, so that memoized conversions are checked too) agree with
+// OpenAssetIO.
+void checkAgainstReference(CachingFileUrlPathConverter& converter, const std::string_view url)
+{
+    const std::optional<std::string> expected = referencePath(url);
+    std::string fastPath;
+    if (CachingFileUrlPathConverter::tryFastPathFromUrl(url, fastPath))
+    {
+        if (!expected || fastPath != *expected)
+        {
+            std::fprintf(stderr,
+                         "fast path mismatch for '%.*s'\n",
+                         static_cast<int>(url.size()),
+                         url.data());
+        }
+        KATANAOPENASSETIO_CHECK(expected && fastPath == *expected);
+    }
+    KATANAOPENASSETIO_CHECK(convertedPath(converter, url) == expected);
+    KATANAOPENASSETIO_CHECK(convertedPath(converter, url) == expected);
+}
+
+bool isFastPath(const std::string_view url)
+{
+    std::string out;
+    return CachingFileUrlPathConverter::tryFastPathFromUrl(url, out);
+}
+
+void testHandledByFastPath()
+{
+#ifndef _WIN32
+    const std::vector<std::string> urls{
+        "file:///a",
+        "file:///mnt/projects/show/seq/shot/textures/diffuse.1001.tx",
+        "file:///mnt/projects/show%20name/caf%C3%A9/a%41b.exr",
+        "file:///lower%2dcase%2a/x",
+        "file:///sub-delims!$&'()*+,;=:@/~_.exr",
+        "file:///a/.hidden/..b/c..",
+    };
+    for (const std::string& url : urls)
+    {
+        KATANAOPENASSETIO_CHECK(isFastPath(url));
+    }
+#endif
+}
+
+void testDeclinedByFastPath()
+{
+    const std::vector<std::string> urls{
+        "file://host/a",
+        "file:/a",
+        "http:///a",
+        "file:///a/./b",
+        "file:///a/../b",
+        "file:///a/.",
+        "file:///a/..",
+        "file:///a//b",
+        "file:///a/%2e%2E/b",
+        "file:///a/%2E/b",
+        "file:///a%2Fb",
+        "file:///a%2fb",
+        "file:///a%00b",
+        "file:///a%zz",
+        "file:///a%2",
+        "file:///a%",
+        "file:///a?query",
+        "file:///a#fragment",
+        "file:///a\\b",
+        "file:///a b",
+        "file:///caf\xC3\xA9",
+        "file:///a\"b",
+        "file:///a[b]",
+    };
+    for (const std::string& url : urls)
+    {
+        KATANAOPENASSETIO_CHECK(!isFastPath(url));
+    }
+}
+
+void testMatchesReference()
+{
+    CachingFileUrlPathConverter converter;
+    const std::vector<std::string> urls{
+        "file:///a",
+        "file:///",
+        "file://",
+        "",
+        "file:///mnt/projects/show%20name/caf%C3%A9/a%41b.exr",
+        "file:///a/./b",
+        "file:///a/../b",
+        "file:///a//b",
+        "file:///a/%2e%2E/b",
+        "file:///a%2Fb",
+        "file:///a%00b",
+        "file:///a%zz",
+        "file:///a?query",
+        "file:///a#fragment",
+        "file://host/a",
+        "file://localhost/a",
+        "file:///a b",
+        "file:///caf\xC3\xA9",
+    };
+    for (const std::string& url : urls)
+    {
+        checkAgainstReference(converter, url);
+    }
+}
+
+// Random URLs over an alphabet weighted towards the characters that
+// the fast path treats specially, to probe the edges of what it
+// accepts. Longer URLs exercise the vectorised scan.
+void testMatchesReferenceRandomised()
+{
+    constexpr std::string_view kAlphabet{"aZ09/./.%%%2eEfF0-_~ ?#\\:@+\xC3"};
+    std::mt19937 rng{20241019};
+    std::uniform_int_distribution<std::size_t> lengthDist{0, 48};
+    std::uniform_int_distribution<std::size_t> charDist{0, kAlphabet.size() - 1};
+
+    CachingFileUrlPathConverter converter;
+    for (int iteration = 0; iteration < 20000; ++iteration)
+    {
+        std::string url = "file:///";
+        const std::size_t length = lengthDist(rng);
+        for (std::size_t idx = 0; idx < length; ++idx)
+        {
+            url.push_back(kAlphabet[charDist(rng)]);
+        }
+        checkAgainstReference(converter, url);
+    }
+}
+}  // namespace
+
+int main()
+{
+    testHandledByFastPath();
+    testDeclinedByFastPath();
+    testMatchesReference();
+    testMatchesReferenceRandomised();
+    return Check::Result();
+}
@@ -0,0 +1,160 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Check.hpp"
+#include "LockFreeQueue.hpp"
+
+namespace
+{
+void testRejectsInvalidCapacity()
+{
+    for (const std::size_t capacity : {0, 1, 3, 6, 100})
+    {
+        bool threw = false;
+        try
+        {
+            LockFreeQueue<int> queue{capacity};
+        }
+        catch (const std::invalid_argument&)
+        {
+            threw = true;
+        }
+        KATANAOPENASSETIO_CHECK(threw);
+    }
+}
+
+void testFifoWhenFullAndEmpty()
+{
+    LockFreeQueue<int> queue{4};
+    KATANAOPENASSETIO_CHECK(queue.capacity() == 4);
+
+    int value = -1;
+    KATANAOPENASSETIO_CHECK(!queue.tryPop(value));
+
+    // Several rounds, so that positions wrap around the cells.
+    int next = 0;
+    for (int round = 0; round < 5; ++round)
+    {
+        for (int idx = 0; idx < 4; ++idx)
+        {
+            KATANAOPENASSETIO_CHECK(queue.tryPush(next + idx));
+        }
+        KATANAOPENASSETIO_CHECK(!queue.tryPush(99));
+        for (int idx = 0; idx < 4; ++idx)
+        {
+            KATANAOPENASSETIO_CHECK(queue.tryPop(value));
+            KATANAOPENASSETIO_CHECK(value == next + idx);
+        }
+        KATANAOPENASSETIO_CHECK(!queue.tryPop(value));
+        next += 4;
+    }
+
+    // Interleaved, so that the queue is never full or empty.
+    KATANAOPENASSETIO_CHECK(queue.tryPush(1));
+    for (int idx = 2; idx < 10; ++idx)
+    {
+        KATANAOPENASSETIO_CHECK(queue.tryPush(int{idx}));
+        KATANAOPENASSETIO_CHECK(queue.tryPop(value));
+        KATANAOPENASSETIO_CHECK(value == idx - 1);
+    }
+}
+
+void testMoveOnlyElements()
+{
+    LockFreeQueue<std::unique_ptr<int>> queue{2};
+    KATANAOPENASSETIO_CHECK(queue.tryPush(std::make_unique<int>(42)));
+    std::unique_ptr<int> value;
+    KATANAOPENASSETIO_CHECK(queue.tryPop(value));
+    KATANAOPENASSETIO_CHECK(value && *value == 42);
+}
+
+// Producers and consumers contend on a small queue. Every element must
+// be received exactly once, and each consumer must see each producer's
+// elements in the order they were pushed.
+void testConcurrentProducersAndConsumers()
+{
+    constexpr std::uint64_t kNumProducers = 4;
+    constexpr std::size_t kNumConsumers = 4;
+    constexpr std::uint64_t kPerProducer = 100000;
+
+    LockFreeQueue<std::uint64_t> queue{64};
+    std::vector<std::atomic<std::uint8_t>> received(kNumProducers * kPerProducer);
+    std::atomic<std::uint64_t> numReceived{0};
+    std::atomic<int> outOfOrder{0};
+
+    std::vector<std::thread> threads;
+    for (std::uint64_t producer = 0; producer < kNumProducers; ++producer)
+    {
+        threads.emplace_back(
+            [&queue, producer]
+            {
+                for (std::uint64_t seq = 0; seq < kPerProducer; ++seq)
+                {
+                    while (!queue.tryPush(producer * kPerProducer + seq))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+    for (std::size_t consumer = 0; consumer < kNumConsumers; ++consumer)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                std::vector<std::uint64_t> lastSeen(kNumProducers, 0);
+                std::vector<bool> seenAny(kNumProducers, false);
+                std::uint64_t value = 0;
+                while (numReceived.load() < kNumProducers * kPerProducer)
+                {
+                    if (!queue.tryPop(value))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    const std::uint64_t producer = value / kPerProducer;
+                    if (seenAny[producer] && value <= lastSeen[producer])
+                    {
+                        ++outOfOrder;
+                    }
+                    seenAny[producer] = true;
+                    lastSeen[producer] = value;
+                    received[value].fetch_add(1);
+                    ++numReceived;
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    KATANAOPENASSETIO_CHECK(outOfOrder.load() == 0);
+    KATANAOPENASSETIO_CHECK(numReceived.load() == kNumProducers * kPerProducer);
+    std::size_t numOnce = 0;
+    for (const std::atomic<std::uint8_t>& count : received)
+    {
+        numOnce += count.load() == 1 ? 1 : 0;
+    }
+    KATANAOPENASSETIO_CHECK(numOnce == received.size());
+    std::uint64_t value = 0;
+    KATANAOPENASSETIO_CHECK(!queue.tryPop(value));
+}
+}  // namespace
+
+int main()
+{
+    testRejectsInvalidCapacity();
+    testFifoWhenFullAndEmpty();
+    testMoveOnlyElements();
+    testConcurrentProducersAndConsumers();
+    return Check::Result();
+}
@@ -0,0 +1,238 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "Check.hpp"
+#include "ResolverProtocol.hpp"
+
+namespace
+{
+using ResolverProtocol::Header;
+using ResolverProtocol::MessageType;
+using ResolverProtocol::Result;
+using ResolverProtocol::Status;
+
+// Split an encoded message into its header and payload.
+Header splitMessage(const std::string& message, std::string_view& payload)
+{
+    Header header{};
+    std::memcpy(&header, message.data(), sizeof(header));
+    payload = std::string_view{message}.substr(sizeof(header));
+    return header;
+}
+
+void testRequestRoundTrip()
+{
+    const std::string binary{"nul\0byte", 8};
+    const std::vector<std::string_view> items{"ams:///a/b?v=1", "", binary};
+    std::string message;
+    ResolverProtocol::EncodeRequest(MessageType::kResolveLocations, items, message);
+
+    std::string_view payload;
+    const Header header = splitMessage(message, payload);
+    KATANAOPENASSETIO_CHECK(header.magic == ResolverProtocol::kMagic);
+    KATANAOPENASSETIO_CHECK(header.version == ResolverProtocol::kVersion);
+    KATANAOPENASSETIO_CHECK(header.type == MessageType::kResolveLocations);
+    KATANAOPENASSETIO_CHECK(header.count == items.size());
+    KATANAOPENASSETIO_CHECK(header.payloadSize == payload.size());
+
+    std::vector<std::string_view> decoded{"stale"};
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::DecodeRequest(header, payload, decoded));
+    KATANAOPENASSETIO_CHECK(decoded == items);
+
+    // No items, as for kFlush.
+    ResolverProtocol::EncodeRequest(MessageType::kFlush, {}, message);
+    const Header emptyHeader = splitMessage(message, payload);
+    KATANAOPENASSETIO_CHECK(emptyHeader.count == 0 && emptyHeader.payloadSize == 0);
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::DecodeRequest(emptyHeader, payload, decoded));
+    KATANAOPENASSETIO_CHECK(decoded.empty());
+}
+
+void testResultsRoundTrip()
+{
+    const std::vector<Result> results{{Status::kOk, "/mnt/a.abc"},
+                                      {Status::kError, "Entity not found"},
+                                      {Status::kOk, ""},
+                                      {Status::kOkVolatile, "/mnt/latest.abc"}};
+    std::string message;
+    ResolverProtocol::EncodeResults(results, message);
+
+    std::string_view payload;
+    const Header header = splitMessage(message, payload);
+    KATANAOPENASSETIO_CHECK(header.type == MessageType::kResults);
+    KATANAOPENASSETIO_CHECK(header.count == results.size());
+
+    std::vector<Result> decoded(5);
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::DecodeResults(header, payload, decoded));
+    KATANAOPENASSETIO_CHECK(decoded.size() == results.size());
+    for (std::size_t idx = 0; idx < results.size() && idx < decoded.size(); ++idx)
+    {
+        KATANAOPENASSETIO_CHECK(decoded[idx].status == results[idx].status);
+        KATANAOPENASSETIO_CHECK(decoded[idx].value == results[idx].value);
+    }
+}
+
+void testRejectsMalformedRequests()
+{
+    std::string message;
+    ResolverProtocol::EncodeRequest(MessageType::kResolveLocations, {"abc", "defgh"}, message);
+    std::string_view payload;
+    Header header = splitMessage(message, payload);
+    std::vector<std::string_view> decoded;
+
+    // Every truncation.
+    for (std::size_t size = 0; size < payload.size(); ++size)
+    {
+        KATANAOPENASSETIO_CHECK(
+            !ResolverProtocol::DecodeRequest(header, payload.substr(0, size), decoded));
+    }
+
+    // Trailing bytes.
+    const std::string padded = std::string{payload} + "x";
+    KATANAOPENASSETIO_CHECK(!ResolverProtocol::DecodeRequest(header, padded, decoded));
+
+    // Counts that disagree with the payload, including one that would
+    // be ruinous to allocate for.
+    for (const std::uint32_t count : {1U, 3U, 0xFFFFFFFFU})
+    {
+        Header badHeader = header;
+        badHeader.count = count;
+        KATANAOPENASSETIO_CHECK(!ResolverProtocol::DecodeRequest(badHeader, payload, decoded));
+    }
+
+    // A string size running past the end of the payload.
+    std::string overrun{payload};
+    const std::uint32_t hugeSize = 0xFFFFFFF0U;
+    std::memcpy(overrun.data(), &hugeSize, sizeof(hugeSize));
+    KATANAOPENASSETIO_CHECK(!ResolverProtocol::DecodeRequest(header, overrun, decoded));
+}
+
+void testRejectsMalformedResults()
+{
+    std::string message;
+    ResolverProtocol::EncodeResults({{Status::kOk, "/a"}, {Status::kError, "oops"}}, message);
+    std::string_view payload;
+    const Header header = splitMessage(message, payload);
+    std::vector<Result> decoded;
+
+    for (std::size_t size = 0; size < payload.size(); ++size)
+    {
+        KATANAOPENASSETIO_CHECK(
+            !ResolverProtocol::DecodeResults(header, payload.substr(0, size), decoded));
+    }
+
+    const std::string padded = std::string{payload} + "x";
+    KATANAOPENASSETIO_CHECK(!ResolverProtocol::DecodeResults(header, padded, decoded));
+
+    for (const std::uint32_t count : {1U, 3U, 0xFFFFFFFFU})
+    {
+        Header badHeader = header;
+        badHeader.count = count;
+        KATANAOPENASSETIO_CHECK(!ResolverProtocol::DecodeResults(badHeader, payload, decoded));
+    }
+}
+
+#ifndef _WIN32
+void testSocketRoundTrip()
+{
+    int fds[2];
+    KATANAOPENASSETIO_CHECK(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::IsPeerCurrentUser(fds[0]));
+
+    std::string message;
+    ResolverProtocol::EncodeRequest(MessageType::kResolveLocations, {"ams:///a"}, message);
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::WriteMessage(fds[0], message));
+
+    Header header{};
+    std::string payload;
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::ReadMessage(fds[1], header, payload));
+    std::vector<std::string_view> items;
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::DecodeRequest(header, payload, items));
+    KATANAOPENASSETIO_CHECK(items.size() == 1 && items.front() == "ams:///a");
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+// Write a request with its header modified by `corrupt`, and check
+// that it's rejected on reading.
+template <typename Fn>
+void checkHeaderRejected(const Fn& corrupt)
+{
+    int fds[2];
+    KATANAOPENASSETIO_CHECK(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+    std::string message;
+    ResolverProtocol::EncodeRequest(MessageType::kResolveLocations, {"ams:///a"}, message);
+    Header header{};
+    std::memcpy(&header, message.data(), sizeof(header));
+    corrupt(header);
+    std::memcpy(message.data(), &header, sizeof(header));
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::WriteMessage(fds[0], message));
+
+    std::string payload;
+    KATANAOPENASSETIO_CHECK(!ResolverProtocol::ReadMessage(fds[1], header, payload));
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+void testRejectsMalformedMessages()
+{
+    checkHeaderRejected([](Header& header) { header.magic = 0x12345678; });
+    checkHeaderRejected([](Header& header) { ++header.version; });
+    checkHeaderRejected([](Header& header)
+                        { header.payloadSize = ResolverProtocol::kMaxPayloadSize + 1; });
+
+    // The peer disconnecting part-way through a message.
+    int fds[2];
+    KATANAOPENASSETIO_CHECK(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    std::string message;
+    ResolverProtocol::EncodeRequest(MessageType::kResolveLocations, {"ams:///a"}, message);
+    message.pop_back();
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::WriteMessage(fds[0], message));
+    ::close(fds[0]);
+    Header header{};
+    std::string payload;
+    KATANAOPENASSETIO_CHECK(!ResolverProtocol::ReadMessage(fds[1], header, payload));
+    ::close(fds[1]);
+}
+
+void testDefaultSocketPath()
+{
+    ::setenv("XDG_RUNTIME_DIR", "/run/user/1234", 1);
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::DefaultSocketPath() ==
+                            "/run/user/1234/katanaopenassetio-resolverd.sock");
+    ::unsetenv("XDG_RUNTIME_DIR");
+    KATANAOPENASSETIO_CHECK(ResolverProtocol::DefaultSocketPath() ==
+                            "/tmp/katanaopenassetio-" + std::to_string(::geteuid()) +
+                                "/resolverd.sock");
+}
+#endif
+}  // namespace
+
+int main()
+{
+    testRequestRoundTrip();
+    testResultsRoundTrip();
+    testRejectsMalformedRequests();
+    testRejectsMalformedResults();
+#ifndef _WIN32
+    testSocketRoundTrip();
+    testRejectsMalformedMessages();
+    testDefaultSocketPath();
+#endif
+    return Check::Result();
+}
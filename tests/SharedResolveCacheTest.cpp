@@ -0,0 +1,265 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "Check.hpp"
+#include "SharedResolveCache.hpp"
+
+#ifndef _WIN32
+namespace
+{
+constexpr std::size_t kSegmentSize = 256 * 1024;
+
+// A segment private to this test run, removed on destruction.
+class ScopedSegmentName
+{
+public:
+    explicit ScopedSegmentName(const char* suffix)
+        : _name{"/katanaopenassetio-test-" + std::to_string(::getpid()) + "-" + suffix}
+    {
+        ::shm_unlink(_name.c_str());
+    }
+
+    ~ScopedSegmentName() { ::shm_unlink(_name.c_str()); }
+
+    ScopedSegmentName(const ScopedSegmentName&) = delete;
+    ScopedSegmentName& operator=(const ScopedSegmentName&) = delete;
+
+    [[nodiscard]] const std::string& str() const { return _name; }
+
+private:
+    std::string _name;
+};
+
+// A value that can be checked for tearing: the key at either end of a
+// run of a single filler character.
+std::string makeValue(const std::string& key, const std::size_t fillLength, const char filler)
+{
+    return key + std::string(fillLength, filler) + key;
+}
+
+bool isWholeValue(const std::string& key, const std::string& value)
+{
+    if (value.size() < 2 * key.size() + 1 || value.compare(0, key.size(), key) != 0 ||
+        value.compare(value.size() - key.size(), key.size(), key) != 0)
+    {
+        return false;
+    }
+    const char filler = value[key.size()];
+    for (std::size_t idx = key.size(); idx < value.size() - key.size(); ++idx)
+    {
+        if (value[idx] != filler)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testOpenRejectsInvalidArguments()
+{
+    KATANAOPENASSETIO_CHECK(SharedResolveCache::open("", kSegmentSize) == nullptr);
+    const ScopedSegmentName name{"tiny"};
+    KATANAOPENASSETIO_CHECK(SharedResolveCache::open(name.str(), 1024) == nullptr);
+}
+
+void testPutGetAndInvalidate()
+{
+    const ScopedSegmentName name{"basic"};
+    const auto cache = SharedResolveCache::open(name.str(), kSegmentSize);
+    KATANAOPENASSETIO_CHECK(cache != nullptr);
+    if (!cache)
+    {
+        return;
+    }
+
+    std::string value;
+    KATANAOPENASSETIO_CHECK(!cache->get("ams:///a", value));
+    cache->put("ams:///a", "/mnt/a.abc");
+    KATANAOPENASSETIO_CHECK(cache->get("ams:///a", value) && value == "/mnt/a.abc");
+    cache->put("ams:///a", "/mnt/a2.abc");
+    KATANAOPENASSETIO_CHECK(cache->get("ams:///a", value) && value == "/mnt/a2.abc");
+    KATANAOPENASSETIO_CHECK(!cache->get("ams:///b", value));
+
+    // Too large for a slot, so not shared.
+    cache->put("ams:///big", std::string(4096, 'x'));
+    KATANAOPENASSETIO_CHECK(!cache->get("ams:///big", value));
+
+    cache->invalidate();
+    KATANAOPENASSETIO_CHECK(!cache->get("ams:///a", value));
+    cache->put("ams:///a", "/mnt/a3.abc");
+    KATANAOPENASSETIO_CHECK(cache->get("ams:///a", value) && value == "/mnt/a3.abc");
+
+    // Another mapping of the same segment sees the same entries, and
+    // its invalidations.
+    const auto other = SharedResolveCache::open(name.str(), kSegmentSize);
+    KATANAOPENASSETIO_CHECK(other != nullptr);
+    if (other)
+    {
+        KATANAOPENASSETIO_CHECK(other->get("ams:///a", value) && value == "/mnt/a3.abc");
+        other->invalidate();
+        KATANAOPENASSETIO_CHECK(!cache->get("ams:///a", value));
+    }
+}
+
+void testErase()
+{
+    const ScopedSegmentName name{"erase"};
+    const auto cache = SharedResolveCache::open(name.str(), kSegmentSize);
+    KATANAOPENASSETIO_CHECK(cache != nullptr);
+    if (!cache)
+    {
+        return;
+    }
+
+    std::string value;
+    cache->erase("ams:///a");
+    cache->put("ams:///a", "/mnt/a.abc");
+    cache->put("ams:///b", "/mnt/b.abc");
+    cache->erase("ams:///a");
+    KATANAOPENASSETIO_CHECK(!cache->get("ams:///a", value));
+    KATANAOPENASSETIO_CHECK(cache->get("ams:///b", value) && value == "/mnt/b.abc");
+    cache->put("ams:///a", "/mnt/a2.abc");
+    KATANAOPENASSETIO_CHECK(cache->get("ams:///a", value) && value == "/mnt/a2.abc");
+
+    // Erased slots don't hide keys probed past them.
+    std::vector<std::string> keys;
+    for (int idx = 0; idx < 128; ++idx)
+    {
+        keys.push_back("ams:///asset" + std::to_string(idx));
+        cache->put(keys.back(), keys.back());
+    }
+    for (std::size_t idx = 0; idx < keys.size(); idx += 2)
+    {
+        cache->erase(keys[idx]);
+    }
+    for (std::size_t idx = 0; idx < keys.size(); ++idx)
+    {
+        const bool found = cache->get(keys[idx], value);
+        KATANAOPENASSETIO_CHECK(idx % 2 == 0 ? !found : !found || value == keys[idx]);
+    }
+}
+
+void testSharedAcrossProcesses()
+{
+    const ScopedSegmentName name{"fork"};
+    const auto cache = SharedResolveCache::open(name.str(), kSegmentSize);
+    KATANAOPENASSETIO_CHECK(cache != nullptr);
+    if (!cache)
+    {
+        return;
+    }
+
+    const pid_t child = ::fork();
+    if (child == 0)
+    {
+        const auto childCache = SharedResolveCache::open(name.str(), kSegmentSize);
+        if (!childCache)
+        {
+            ::_exit(EXIT_FAILURE);
+        }
+        childCache->put("ams:///from-child", "/mnt/child.abc");
+        ::_exit(EXIT_SUCCESS);
+    }
+    int status = 0;
+    KATANAOPENASSETIO_CHECK(child > 0 && ::waitpid(child, &status, 0) == child);
+    KATANAOPENASSETIO_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+
+    std::string value;
+    KATANAOPENASSETIO_CHECK(cache->get("ams:///from-child", value) && value == "/mnt/child.abc");
+}
+
+// Writers and readers contend on a few hundred keys, so that slots are
+// frequently read whilst being written. Readers must only ever see
+// whole values, for the key they looked up.
+void testConcurrentPutAndGet()
+{
+    const ScopedSegmentName name{"concurrent"};
+    const auto cache = SharedResolveCache::open(name.str(), kSegmentSize);
+    KATANAOPENASSETIO_CHECK(cache != nullptr);
+    if (!cache)
+    {
+        return;
+    }
+
+    constexpr int kNumThreads = 8;
+    constexpr int kNumOps = 50000;
+    constexpr int kNumKeys = 300;
+    std::atomic<int> numHits{0};
+    std::atomic<int> numTorn{0};
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < kNumThreads; ++thread)
+    {
+        threads.emplace_back(
+            [&, thread]
+            {
+                std::string value;
+                for (int op = 0; op < kNumOps; ++op)
+                {
+                    const std::string key =
+                        "ams:///asset" + std::to_string((op * 7 + thread) % kNumKeys);
+                    if (op % 3 == 0)
+                    {
+                        cache->put(key,
+                                   makeValue(key,
+                                             static_cast<std::size_t>(50 + op % 300),
+                                             static_cast<char>('a' + thread)));
+                    }
+                    else if (cache->get(key, value))
+                    {
+                        ++numHits;
+                        if (!isWholeValue(key, value))
+                        {
+                            ++numTorn;
+                        }
+                    }
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    KATANAOPENASSETIO_CHECK(numTorn.load() == 0);
+    KATANAOPENASSETIO_CHECK(numHits.load() > 0);
+
+    // Every key was last written by someone, and whatever survived
+    // must be intact.
+    std::string value;
+    for (int keyIdx = 0; keyIdx < kNumKeys; ++keyIdx)
+    {
+        const std::string key = "ams:///asset" + std::to_string(keyIdx);
+        if (cache->get(key, value))
+        {
+            KATANAOPENASSETIO_CHECK(isWholeValue(key, value));
+        }
+    }
+}
+}  // namespace
+#endif
+
+int main()
+{
+#ifndef _WIN32
+    testOpenRejectsInvalidArguments();
+    testPutGetAndInvalidate();
+    testErase();
+    testSharedAcrossProcesses();
+    testConcurrentPutAndGet();
+#endif
+    return Check::Result();
+}
@@ -0,0 +1,168 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Check.hpp"
+#include "StringTable.hpp"
+
+namespace
+{
+using Handle = StringTable::Handle;
+
+// Paths sharing prefixes, with the occasional suffix too large for an
+// arena block.
+std::string makePath(const int idx)
+{
+    std::string path = "/a/b" + std::to_string(idx % 7) + "/c" + std::to_string(idx);
+    if (idx % 100 == 0)
+    {
+        path.append(20000, 'x');
+    }
+    return path;
+}
+
+void testInternAndFind()
+{
+    StringTable table;
+    KATANAOPENASSETIO_CHECK(table.find("/a/b") == StringTable::kInvalidHandle);
+
+    const Handle handle = table.intern("/a/b/c");
+    KATANAOPENASSETIO_CHECK(handle != StringTable::kInvalidHandle);
+    KATANAOPENASSETIO_CHECK(table.intern("/a/b/c") == handle);
+    KATANAOPENASSETIO_CHECK(table.find("/a/b/c") == handle);
+    KATANAOPENASSETIO_CHECK(table.str(handle) == "/a/b/c");
+
+    std::string out = "prefix:";
+    table.appendTo(handle, out);
+    KATANAOPENASSETIO_CHECK(out == "prefix:/a/b/c");
+
+    KATANAOPENASSETIO_CHECK(table.intern("") == table.intern(""));
+    KATANAOPENASSETIO_CHECK(table.str(table.find("")).empty());
+    KATANAOPENASSETIO_CHECK(table.find("a/b") == StringTable::kInvalidHandle);
+
+    table.clear();
+    KATANAOPENASSETIO_CHECK(table.size() == 0);
+    KATANAOPENASSETIO_CHECK(table.find("/a/b/c") == StringTable::kInvalidHandle);
+}
+
+void testSharedPrefixes()
+{
+    StringTable table;
+    const Handle first = table.intern("/a/b/c/d");
+    // The unique tail of a string isn't split by path component.
+    KATANAOPENASSETIO_CHECK(table.size() == 1);
+    KATANAOPENASSETIO_CHECK(table.find("/a/b") == StringTable::kInvalidHandle);
+
+    // Until another string shares part of it.
+    const Handle second = table.intern("/a/b/x");
+    KATANAOPENASSETIO_CHECK(table.size() == 3);
+    KATANAOPENASSETIO_CHECK(table.find("/a/b/c/d") == first);
+    KATANAOPENASSETIO_CHECK(table.str(first) == "/a/b/c/d");
+    KATANAOPENASSETIO_CHECK(table.str(second) == "/a/b/x");
+    const Handle prefix = table.find("/a/b");
+    KATANAOPENASSETIO_CHECK(prefix != StringTable::kInvalidHandle && table.str(prefix) == "/a/b");
+    KATANAOPENASSETIO_CHECK(table.find("/a/b/c") == StringTable::kInvalidHandle);
+
+    // Interning a prefix of a string splits it off too.
+    const Handle third = table.intern("/a/b/c");
+    KATANAOPENASSETIO_CHECK(table.str(third) == "/a/b/c");
+    KATANAOPENASSETIO_CHECK(table.intern("/a/b/c") == third);
+    KATANAOPENASSETIO_CHECK(table.str(first) == "/a/b/c/d");
+    KATANAOPENASSETIO_CHECK(table.find("/a") == StringTable::kInvalidHandle);
+    KATANAOPENASSETIO_CHECK(table.find("/a/") == StringTable::kInvalidHandle);
+
+    // Splitting gives entries parents with later handles, which
+    // compaction must cope with.
+    const std::vector<Handle> remap = table.retain({first});
+    KATANAOPENASSETIO_CHECK(table.str(remap[first]) == "/a/b/c/d");
+    KATANAOPENASSETIO_CHECK(table.find("/a/b/c/d") == remap[first]);
+    KATANAOPENASSETIO_CHECK(remap[second] == StringTable::kInvalidHandle);
+    KATANAOPENASSETIO_CHECK(table.find("/a/b/x") == StringTable::kInvalidHandle);
+    KATANAOPENASSETIO_CHECK(table.str(table.intern("/a/b/y")) == "/a/b/y");
+    KATANAOPENASSETIO_CHECK(table.str(remap[first]) == "/a/b/c/d");
+
+    // Split beyond the offset that can be stored in place.
+    const std::string longPrefix = "/long" + std::string(70000, 'x');
+    const Handle longFirst = table.intern(longPrefix + "/a");
+    const Handle longSecond = table.intern(longPrefix + "/b");
+    KATANAOPENASSETIO_CHECK(table.str(longFirst) == longPrefix + "/a");
+    KATANAOPENASSETIO_CHECK(table.str(longSecond) == longPrefix + "/b");
+    KATANAOPENASSETIO_CHECK(table.str(table.find(longPrefix)) == longPrefix);
+}
+
+void testManyStrings()
+{
+    StringTable table;
+    std::vector<Handle> handles;
+    for (int idx = 0; idx < 20000; ++idx)
+    {
+        handles.push_back(table.intern(makePath(idx)));
+    }
+    for (int idx = 0; idx < 20000; ++idx)
+    {
+        KATANAOPENASSETIO_CHECK(table.find(makePath(idx)) == handles[idx]);
+        KATANAOPENASSETIO_CHECK(table.str(handles[idx]) == makePath(idx));
+    }
+    KATANAOPENASSETIO_CHECK(table.memoryUsage() > StringTable::baseUsage());
+}
+
+void testRetain()
+{
+    StringTable table;
+    std::vector<Handle> handles;
+    for (int idx = 0; idx < 20000; ++idx)
+    {
+        handles.push_back(table.intern(makePath(idx)));
+    }
+
+    std::vector<Handle> kept;
+    for (int idx = 0; idx < 20000; idx += 3)
+    {
+        kept.push_back(handles[idx]);
+        kept.push_back(handles[idx]);
+    }
+    kept.push_back(StringTable::kInvalidHandle);
+
+    const std::size_t usageBefore = table.memoryUsage();
+    const std::vector<Handle> remap = table.retain(kept);
+    KATANAOPENASSETIO_CHECK(table.memoryUsage() < usageBefore);
+
+    for (int idx = 0; idx < 20000; ++idx)
+    {
+        const Handle remapped = remap[handles[idx]];
+        if (idx % 3 == 0)
+        {
+            KATANAOPENASSETIO_CHECK(remapped != StringTable::kInvalidHandle);
+            KATANAOPENASSETIO_CHECK(table.str(remapped) == makePath(idx));
+            KATANAOPENASSETIO_CHECK(table.find(makePath(idx)) == remapped);
+        }
+        else
+        {
+            KATANAOPENASSETIO_CHECK(remapped == StringTable::kInvalidHandle);
+            KATANAOPENASSETIO_CHECK(table.find(makePath(idx)) == StringTable::kInvalidHandle);
+        }
+    }
+
+    // Removed strings can be interned again.
+    const Handle reinterned = table.intern(makePath(1));
+    KATANAOPENASSETIO_CHECK(reinterned != StringTable::kInvalidHandle);
+    KATANAOPENASSETIO_CHECK(table.str(reinterned) == makePath(1));
+
+    table.retain({});
+    KATANAOPENASSETIO_CHECK(table.size() == 0);
+    KATANAOPENASSETIO_CHECK(table.find(makePath(0)) == StringTable::kInvalidHandle);
+}
+}  // namespace
+
+int main()
+{
+    testInternAndFind();
+    testSharedPrefixes();
+    testManyStrings();
+    testRetain();
+    return Check::Result();
+}
@@ -0,0 +1,397 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// katanaopenassetio-replay: replays AssetAPI calls recorded by the
+// plugin (see KATANAOPENASSETIO_RECORD_CALLS) against the configured
+// manager, or a mock, and reports recorded versus replayed latencies
+// per method.
+//
+// Each recorded thread is replayed on its own thread. By default calls
+// are issued at their original offsets from the start of recording;
+// --fast issues each as soon as the previous call on its thread
+// returns. Calls that publish or write metadata are skipped unless
+// --include-writes is given.
+//
+// Usage: katanaopenassetio-replay LOG [--fast] [--include-writes]
+//            [--mock [--mock-prefix PREFIX] [--mock-latency-us N]
+//                    [--mock-jitter-us N] [--mock-error-rate P]]
+#include <Python.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "CallLog.hpp"
+#include "Constants.hpp"
+#include "Environment.hpp"
+#include "MockManagerInterface.hpp"
+#include "OpenAssetIOAsset.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct ReplayOptions
+{
+    std::string logPath;
+    bool fast = false;
+    bool includeWrites = false;
+    bool mock = false;
+    MockManagerInterface::Options mockOptions;
+};
+
+struct ReplayResult
+{
+    std::uint64_t durationNs = 0;
+    bool threw = false;
+    bool skipped = false;
+};
+
+bool isWrite(const CallLog::Method method)
+{
+    return method == CallLog::Method::kSetAssetAttributes ||
+           method == CallLog::Method::kCreateAssetAndPath ||
+           method == CallLog::Method::kPostCreateAsset;
+}
+
+void replayCall(OpenAssetIOAsset& asset, const CallLog::Record& record)
+{
+    using Method = CallLog::Method;
+
+    const auto arg = [&record](const std::size_t idx) -> const std::string&
+    {
+        if (idx >= record.args.size())
+        {
+            throw std::runtime_error{std::string{"Too few arguments recorded for "} +
+                                     CallLog::MethodName(record.method)};
+        }
+        return record.args[idx];
+    };
+    const auto mapArg = [&arg](const std::size_t idx)
+    {
+        OpenAssetIOAsset::StringMap map;
+        if (!CallLog::DecodeStringMap(arg(idx), map))
+        {
+            throw std::runtime_error{"Malformed string map argument"};
+        }
+        return map;
+    };
+    const auto boolArg = [&arg](const std::size_t idx) { return arg(idx) == "1"; };
+
+    std::string ret;
+    OpenAssetIOAsset::StringMap retMap;
+    OpenAssetIOAsset::StringVector retVector;
+
+    switch (record.method)
+    {
+        case Method::kReset:
+            asset.reset();
+            break;
+        case Method::kIsAssetId:
+            asset.isAssetId(arg(0));
+            break;
+        case Method::kContainsAssetId:
+            asset.containsAssetId(arg(0));
+            break;
+        case Method::kCheckPermissions:
+            asset.checkPermissions(arg(0), mapArg(1));
+            break;
+        case Method::kRunAssetPluginCommand:
+            asset.runAssetPluginCommand(arg(0), arg(1), mapArg(2));
+            break;
+        case Method::kResolveAsset:
+            asset.resolveAsset(arg(0), ret);
+            break;
+        case Method::kResolveAllAssets:
+            asset.resolveAllAssets(arg(0), ret);
+            break;
+        case Method::kResolvePath:
+            asset.resolvePath(arg(0), std::stoi(arg(1)), ret);
+            break;
+        case Method::kResolveAssetVersion:
+            asset.resolveAssetVersion(arg(0), ret, arg(1));
+            break;
+        case Method::kGetUniqueScenegraphLocationFromAssetId:
+            asset.getUniqueScenegraphLocationFromAssetId(arg(0), boolArg(1), ret);
+            break;
+        case Method::kGetAssetDisplayName:
+            asset.getAssetDisplayName(arg(0), ret);
+            break;
+        case Method::kGetAssetVersions:
+            asset.getAssetVersions(arg(0), retVector);
+            break;
+        case Method::kGetRelatedAssetId:
+            asset.getRelatedAssetId(arg(0), arg(1), ret);
+            break;
+        case Method::kGetAssetFields:
+            asset.getAssetFields(arg(0), boolArg(1), retMap);
+            break;
+        case Method::kBuildAssetId:
+            asset.buildAssetId(mapArg(0), ret);
+            break;
+        case Method::kGetAssetAttributes:
+            asset.getAssetAttributes(arg(0), arg(1), retMap);
+            break;
+        case Method::kSetAssetAttributes:
+            asset.setAssetAttributes(arg(0), arg(1), mapArg(2));
+            break;
+        case Method::kGetAssetIdForScope:
+            asset.getAssetIdForScope(arg(0), arg(1), ret);
+            break;
+        case Method::kCreateAssetAndPath:
+            asset.createAssetAndPath(nullptr, arg(0), mapArg(1), mapArg(2), boolArg(3), ret);
+            break;
+        case Method::kPostCreateAsset:
+            asset.postCreateAsset(nullptr, arg(0), mapArg(1), mapArg(2), ret);
+            break;
+        case Method::kCount:
+            break;
+    }
+}
+
+double percentileUs(std::vector<std::uint64_t>& samplesNs, const double percentile)
+{
+    if (samplesNs.empty())
+    {
+        return 0.0;
+    }
+    const auto rank =
+        static_cast<std::size_t>(percentile * static_cast<double>(samplesNs.size() - 1));
+    std::nth_element(samplesNs.begin(), samplesNs.begin() + rank, samplesNs.end());
+    return static_cast<double>(samplesNs[rank]) / 1000.0;
+}
+
+void printReport(const std::vector<CallLog::Record>& records,
+                 const std::vector<ReplayResult>& results,
+                 const Clock::duration wallTime)
+{
+    struct MethodStats
+    {
+        std::vector<std::uint64_t> recordedNs;
+        std::vector<std::uint64_t> replayedNs;
+        std::size_t skipped = 0;
+        std::size_t outcomeMismatches = 0;
+    };
+    std::map<CallLog::Method, MethodStats> stats;
+
+    for (std::size_t idx = 0; idx < records.size(); ++idx)
+    {
+        MethodStats& methodStats = stats[records[idx].method];
+        if (results[idx].skipped)
+        {
+            ++methodStats.skipped;
+            continue;
+        }
+        methodStats.recordedNs.push_back(records[idx].durationNs);
+        methodStats.replayedNs.push_back(results[idx].durationNs);
+        if (results[idx].threw != (records[idx].outcome == CallLog::Outcome::kThrew))
+        {
+            ++methodStats.outcomeMismatches;
+        }
+    }
+
+    std::printf("%-40s %8s %8s %12s %12s %12s %12s %9s\n",
+                "method",
+                "calls",
+                "skipped",
+                "rec p50 us",
+                "rep p50 us",
+                "rec p99 us",
+                "rep p99 us",
+                "mismatch");
+    for (auto& [method, methodStats] : stats)
+    {
+        std::printf("%-40s %8zu %8zu %12.1f %12.1f %12.1f %12.1f %9zu\n",
+                    CallLog::MethodName(method),
+                    methodStats.recordedNs.size(),
+                    methodStats.skipped,
+                    percentileUs(methodStats.recordedNs, 0.5),
+                    percentileUs(methodStats.replayedNs, 0.5),
+                    percentileUs(methodStats.recordedNs, 0.99),
+                    percentileUs(methodStats.replayedNs, 0.99),
+                    methodStats.outcomeMismatches);
+    }
+    std::printf("\nReplayed %zu calls in %.3f s\n",
+                records.size(),
+                std::chrono::duration<double>(wallTime).count());
+}
+
+int usage(const char* argv0)
+{
+    std::cerr << "Usage: " << argv0
+              << " LOG [--fast] [--include-writes]"
+                 " [--mock [--mock-prefix PREFIX] [--mock-latency-us N]"
+                 " [--mock-jitter-us N] [--mock-error-rate P]]\n";
+    return EXIT_FAILURE;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    ReplayOptions options;
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
+    {
+        const std::string_view arg{argv[argIdx]};
+        if (arg == "--fast")
+        {
+            options.fast = true;
+        }
+        else if (arg == "--include-writes")
+        {
+            options.includeWrites = true;
+        }
+        else if (arg == "--mock")
+        {
+            options.mock = true;
+        }
+        else if (arg == "--mock-prefix" && argIdx + 1 < argc)
+        {
+            options.mockOptions.prefix = argv[++argIdx];
+        }
+        else if (arg == "--mock-latency-us" && argIdx + 1 < argc)
+        {
+            options.mockOptions.latency = std::chrono::microseconds{std::atoll(argv[++argIdx])};
+        }
+        else if (arg == "--mock-jitter-us" && argIdx + 1 < argc)
+        {
+            options.mockOptions.jitter = std::chrono::microseconds{std::atoll(argv[++argIdx])};
+        }
+        else if (arg == "--mock-error-rate" && argIdx + 1 < argc)
+        {
+            options.mockOptions.errorRate = std::clamp(std::atof(argv[++argIdx]), 0.0, 1.0);
+        }
+        else if (options.logPath.empty() && !arg.empty() && arg.front() != '-')
+        {
+            options.logPath = arg;
+        }
+        else
+        {
+            return usage(argv[0]);
+        }
+    }
+    if (options.logPath.empty())
+    {
+        return usage(argv[0]);
+    }
+
+    std::vector<CallLog::Record> records;
+    try
+    {
+        CallLog::FileHeader header{};
+        records = CallLog::ReadLog(options.logPath, header);
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << exc.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // Don't record the replay.
+#ifdef _WIN32
+    _putenv_s(Constants::kRecordCallsEnvVar, "");
+#else
+    ::unsetenv(Constants::kRecordCallsEnvVar);
+#endif
+
+    // Unlike inside Katana, nothing else will have started Python.
+    const bool usePython =
+        !options.mock && !Environment::IsFlagSet(Constants::kDisablePythonEnvVar);
+    if (usePython && !Py_IsInitialized())
+    {
+        Py_InitializeEx(0);
+    }
+
+    std::unique_ptr<OpenAssetIOAsset> asset;
+    try
+    {
+        if (options.mock)
+        {
+            asset = std::make_unique<OpenAssetIOAsset>(
+                [mockOptions = options.mockOptions](const auto& hostInterface, const auto& logger)
+                { return MockManagerInterface::makeManager(mockOptions, hostInterface, logger); });
+        }
+        else
+        {
+            asset = std::make_unique<OpenAssetIOAsset>();
+        }
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << exc.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // Release the GIL, so that replay threads can acquire it when
+    // calling into a Python manager.
+    PyThreadState* const mainThreadState = usePython ? PyEval_SaveThread() : nullptr;
+
+    std::map<std::uint32_t, std::vector<std::size_t>> recordsByThread;
+    for (std::size_t idx = 0; idx < records.size(); ++idx)
+    {
+        recordsByThread[records[idx].threadIndex].push_back(idx);
+    }
+
+    std::vector<ReplayResult> results(records.size());
+    const Clock::time_point replayStart = Clock::now();
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(recordsByThread.size());
+        for (const auto& [threadIndex, recordIndices] : recordsByThread)
+        {
+            threads.emplace_back(
+                [&, &recordIndices = recordIndices]
+                {
+                    for (const std::size_t recordIdx : recordIndices)
+                    {
+                        const CallLog::Record& record = records[recordIdx];
+                        ReplayResult& result = results[recordIdx];
+                        if (!options.includeWrites && isWrite(record.method))
+                        {
+                            result.skipped = true;
+                            continue;
+                        }
+                        if (!options.fast)
+                        {
+                            std::this_thread::sleep_until(
+                                replayStart + std::chrono::nanoseconds{record.startNs});
+                        }
+                        const Clock::time_point callStart = Clock::now();
+                        try
+                        {
+                            replayCall(*asset, record);
+                        }
+                        catch (const std::exception&)
+                        {
+                            result.threw = true;
+                        }
+                        result.durationNs = static_cast<std::uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                                                 callStart)
+                                .count());
+                    }
+                });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    const Clock::duration wallTime = Clock::now() - replayStart;
+
+    if (mainThreadState != nullptr)
+    {
+        PyEval_RestoreThread(mainThreadState);
+    }
+
+    printReport(records, results, wallTime);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,421 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// katanaopenassetio-loadgen: drives the plugin from many threads with a
+// weighted mix of AssetAPI calls, against a mock manager with injected
+// latency, jitter and errors, or against the configured manager, and
+// reports throughput and latency percentiles per thread count.
+//
+// For each thread count the plugin is reset, discarding its caches,
+// then every thread issues calls back to back for the given duration.
+// Each call is chosen at random according to the mix, for one of
+// --assets distinct assets. A "publish" is a createAssetAndPath
+// followed by a postCreateAsset.
+//
+// Usage: katanaopenassetio-loadgen [--threads N,N,...] [--duration-s N]
+//            [--mix OP=WEIGHT,...] [--assets N] [--configured]
+//            [--mock-prefix PREFIX] [--mock-latency-us N]
+//            [--mock-jitter-us N] [--mock-error-rate P]
+#include <Python.h>
+
+#include <FnAsset/plugin/FnAsset.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Constants.hpp"
+#include "Environment.hpp"
+#include "MockManagerInterface.hpp"
+#include "OpenAssetIOAsset.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+enum class Operation : std::uint8_t
+{
+    kResolvePath,
+    kGetAssetFields,
+    kBuildAssetId,
+    kPublish,
+    kCount
+};
+
+constexpr auto kNumOperations = static_cast<std::size_t>(Operation::kCount);
+
+constexpr std::array<const char*, kNumOperations> kOperationNames{
+    "resolvePath", "getAssetFields", "buildAssetId", "publish"};
+
+struct LoadOptions
+{
+    std::vector<std::size_t> threadCounts{1, 2, 4, 8, 16};
+    std::chrono::seconds duration{5};
+    std::array<double, kNumOperations> mix{70, 20, 8, 2};
+    std::size_t numAssets = 10000;
+    bool configured = false;
+    MockManagerInterface::Options mockOptions;
+};
+
+struct OperationStats
+{
+    std::vector<std::uint64_t> latenciesNs;
+    std::size_t errors = 0;
+};
+using Stats = std::array<OperationStats, kNumOperations>;
+
+std::vector<std::string_view> split(std::string_view str, const char delimiter)
+{
+    std::vector<std::string_view> parts;
+    while (!str.empty())
+    {
+        const auto end = str.find(delimiter);
+        parts.push_back(str.substr(0, end));
+        str.remove_prefix(end == std::string_view::npos ? str.size() : end + 1);
+    }
+    return parts;
+}
+
+bool parseThreadCounts(const std::string_view arg, std::vector<std::size_t>& threadCounts)
+{
+    threadCounts.clear();
+    for (const std::string_view part : split(arg, ','))
+    {
+        const long long count = std::atoll(std::string{part}.c_str());
+        if (count <= 0)
+        {
+            return false;
+        }
+        threadCounts.push_back(static_cast<std::size_t>(count));
+    }
+    return !threadCounts.empty();
+}
+
+// Operations not listed have a weight of zero.
+bool parseMix(const std::string_view arg, std::array<double, kNumOperations>& mix)
+{
+    mix.fill(0);
+    for (const std::string_view part : split(arg, ','))
+    {
+        const auto equals = part.find('=');
+        if (equals == std::string_view::npos)
+        {
+            return false;
+        }
+        const auto nameIt =
+            std::find(kOperationNames.begin(), kOperationNames.end(), part.substr(0, equals));
+        const double weight = std::atof(std::string{part.substr(equals + 1)}.c_str());
+        if (nameIt == kOperationNames.end() || weight < 0)
+        {
+            return false;
+        }
+        mix[static_cast<std::size_t>(nameIt - kOperationNames.begin())] = weight;
+    }
+    return std::any_of(mix.begin(), mix.end(), [](const double weight) { return weight > 0; });
+}
+
+void runOperation(OpenAssetIOAsset& asset, const Operation operation, const std::string& assetId)
+{
+    std::string ret;
+    switch (operation)
+    {
+        case Operation::kResolvePath:
+            asset.resolvePath(assetId, 1, ret);
+            break;
+        case Operation::kGetAssetFields:
+        {
+            OpenAssetIOAsset::StringMap fields;
+            asset.getAssetFields(assetId, false, fields);
+            break;
+        }
+        case Operation::kBuildAssetId:
+            asset.buildAssetId(
+                {{Constants::kAssetId, assetId}, {kFnAssetFieldVersion, "1"}}, ret);
+            break;
+        case Operation::kPublish:
+        {
+            const OpenAssetIOAsset::StringMap fields{{Constants::kAssetId, assetId}};
+            asset.createAssetAndPath(nullptr, kFnAssetTypeKatanaScene, fields, {}, false, ret);
+            asset.postCreateAsset(nullptr, kFnAssetTypeKatanaScene, fields, {}, ret);
+            break;
+        }
+        case Operation::kCount:
+            break;
+    }
+}
+
+// Issue calls until the deadline, recording the latency of each.
+void runWorker(OpenAssetIOAsset& asset,
+               const LoadOptions& options,
+               const std::vector<std::string>& assetIds,
+               const Clock::time_point deadline,
+               Stats& stats)
+{
+    std::minstd_rand engine{std::random_device{}()};
+    std::discrete_distribution<std::size_t> pickOperation{options.mix.begin(), options.mix.end()};
+    std::uniform_int_distribution<std::size_t> pickAsset{0, assetIds.size() - 1};
+
+    for (Clock::time_point callStart = Clock::now(); callStart < deadline;)
+    {
+        const std::size_t operationIdx = pickOperation(engine);
+        OperationStats& operationStats = stats[operationIdx];
+        try
+        {
+            runOperation(
+                asset, static_cast<Operation>(operationIdx), assetIds[pickAsset(engine)]);
+        }
+        catch (const std::exception&)
+        {
+            ++operationStats.errors;
+        }
+        const Clock::time_point callEnd = Clock::now();
+        operationStats.latenciesNs.push_back(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(callEnd - callStart).count()));
+        callStart = callEnd;
+    }
+}
+
+double percentileUs(std::vector<std::uint64_t>& samplesNs, const double percentile)
+{
+    if (samplesNs.empty())
+    {
+        return 0.0;
+    }
+    const auto rank =
+        static_cast<std::size_t>(percentile * static_cast<double>(samplesNs.size() - 1));
+    std::nth_element(samplesNs.begin(), samplesNs.begin() + rank, samplesNs.end());
+    return static_cast<double>(samplesNs[rank]) / 1000.0;
+}
+
+void printRow(const std::size_t numThreads,
+              const char* name,
+              OperationStats& stats,
+              const double seconds)
+{
+    std::printf("%8zu %-16s %10zu %8zu %12.1f %11.1f %11.1f %11.1f\n",
+                numThreads,
+                name,
+                stats.latenciesNs.size(),
+                stats.errors,
+                static_cast<double>(stats.latenciesNs.size()) / seconds,
+                percentileUs(stats.latenciesNs, 0.5),
+                percentileUs(stats.latenciesNs, 0.99),
+                percentileUs(stats.latenciesNs, 0.999));
+}
+
+void printReport(const std::size_t numThreads, Stats& stats, const Clock::duration wallTime)
+{
+    const double seconds = std::chrono::duration<double>(wallTime).count();
+    OperationStats total;
+    for (std::size_t operationIdx = 0; operationIdx < kNumOperations; ++operationIdx)
+    {
+        OperationStats& operationStats = stats[operationIdx];
+        if (operationStats.latenciesNs.empty())
+        {
+            continue;
+        }
+        total.latenciesNs.insert(total.latenciesNs.end(),
+                                 operationStats.latenciesNs.begin(),
+                                 operationStats.latenciesNs.end());
+        total.errors += operationStats.errors;
+        printRow(numThreads, kOperationNames[operationIdx], operationStats, seconds);
+    }
+    printRow(numThreads, "all", total, seconds);
+    std::fflush(stdout);
+}
+
+int usage(const char* argv0)
+{
+    std::cerr << "Usage: " << argv0
+              << " [--threads N,N,...] [--duration-s N] [--mix OP=WEIGHT,...] [--assets N]"
+                 " [--configured] [--mock-prefix PREFIX] [--mock-latency-us N]"
+                 " [--mock-jitter-us N] [--mock-error-rate P]\n"
+                 "Operations: resolvePath, getAssetFields, buildAssetId, publish\n";
+    return EXIT_FAILURE;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    LoadOptions options;
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
+    {
+        const std::string_view arg{argv[argIdx]};
+        const bool hasValue = argIdx + 1 < argc;
+        if (arg == "--threads" && hasValue)
+        {
+            if (!parseThreadCounts(argv[++argIdx], options.threadCounts))
+            {
+                return usage(argv[0]);
+            }
+        }
+        else if (arg == "--duration-s" && hasValue)
+        {
+            options.duration = std::chrono::seconds{std::max(1LL, std::atoll(argv[++argIdx]))};
+        }
+        else if (arg == "--mix" && hasValue)
+        {
+            if (!parseMix(argv[++argIdx], options.mix))
+            {
+                return usage(argv[0]);
+            }
+        }
+        else if (arg == "--assets" && hasValue)
+        {
+            options.numAssets =
+                std::max<std::size_t>(1, std::strtoull(argv[++argIdx], nullptr, 10));
+        }
+        else if (arg == "--configured")
+        {
+            options.configured = true;
+        }
+        else if (arg == "--mock-prefix" && hasValue)
+        {
+            options.mockOptions.prefix = argv[++argIdx];
+        }
+        else if (arg == "--mock-latency-us" && hasValue)
+        {
+            options.mockOptions.latency = std::chrono::microseconds{std::atoll(argv[++argIdx])};
+        }
+        else if (arg == "--mock-jitter-us" && hasValue)
+        {
+            options.mockOptions.jitter = std::chrono::microseconds{std::atoll(argv[++argIdx])};
+        }
+        else if (arg == "--mock-error-rate" && hasValue)
+        {
+            options.mockOptions.errorRate = std::clamp(std::atof(argv[++argIdx]), 0.0, 1.0);
+        }
+        else
+        {
+            return usage(argv[0]);
+        }
+    }
+
+    // Don't record the load.
+#ifdef _WIN32
+    _putenv_s(Constants::kRecordCallsEnvVar, "");
+#else
+    ::unsetenv(Constants::kRecordCallsEnvVar);
+#endif
+
+    // Unlike inside Katana, nothing else will have started Python.
+    const bool usePython =
+        options.configured && !Environment::IsFlagSet(Constants::kDisablePythonEnvVar);
+    if (usePython && !Py_IsInitialized())
+    {
+        Py_InitializeEx(0);
+    }
+
+    std::unique_ptr<OpenAssetIOAsset> asset;
+    try
+    {
+        if (options.configured)
+        {
+            asset = std::make_unique<OpenAssetIOAsset>();
+        }
+        else
+        {
+            asset = std::make_unique<OpenAssetIOAsset>(
+                [mockOptions = options.mockOptions](const auto& hostInterface, const auto& logger)
+                { return MockManagerInterface::makeManager(mockOptions, hostInterface, logger); });
+        }
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << exc.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // Entity references for the configured manager are unknown, so its
+    // assets are named with the mock's prefix, which may be overridden
+    // to suit.
+    std::vector<std::string> assetIds;
+    assetIds.reserve(options.numAssets);
+    for (std::size_t idx = 0; idx < options.numAssets; ++idx)
+    {
+        assetIds.push_back(options.mockOptions.prefix + "loadgen/asset" + std::to_string(idx));
+    }
+
+    // Release the GIL, so that worker threads can acquire it when
+    // calling into a Python manager.
+    PyThreadState* const mainThreadState = usePython ? PyEval_SaveThread() : nullptr;
+
+    std::printf("%8s %-16s %10s %8s %12s %11s %11s %11s\n",
+                "threads",
+                "operation",
+                "calls",
+                "errors",
+                "calls/s",
+                "p50 us",
+                "p99 us",
+                "p999 us");
+    for (const std::size_t numThreads : options.threadCounts)
+    {
+        // Each step starts cold.
+        asset->reset();
+
+        std::vector<Stats> threadStats(numThreads);
+        const Clock::time_point start = Clock::now();
+        const Clock::time_point deadline = start + options.duration;
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(numThreads);
+            for (Stats& stats : threadStats)
+            {
+                threads.emplace_back(
+                    [&, &stats = stats]
+                    { runWorker(*asset, options, assetIds, deadline, stats); });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+        const Clock::duration wallTime = Clock::now() - start;
+
+        Stats stats;
+        for (Stats& perThread : threadStats)
+        {
+            for (std::size_t operationIdx = 0; operationIdx < kNumOperations; ++operationIdx)
+            {
+                auto& latenciesNs = stats[operationIdx].latenciesNs;
+                latenciesNs.insert(latenciesNs.end(),
+                                   perThread[operationIdx].latenciesNs.begin(),
+                                   perThread[operationIdx].latenciesNs.end());
+                stats[operationIdx].errors += perThread[operationIdx].errors;
+            }
+        }
+        printReport(numThreads, stats, wallTime);
+    }
+
+    if (const auto counters = asset->prefetcherCounters())
+    {
+        std::printf("prefetch: %llu requested, %llu prefetched, %llu hits, %llu late hits, "
+                    "%llu wasted, %llu dropped, %llu failed\n",
+                    static_cast<unsigned long long>(counters->requested),
+                    static_cast<unsigned long long>(counters->prefetched),
+                    static_cast<unsigned long long>(counters->hits),
+                    static_cast<unsigned long long>(counters->lateHits),
+                    static_cast<unsigned long long>(counters->wasted),
+                    static_cast<unsigned long long>(counters->dropped),
+                    static_cast<unsigned long long>(counters->failures));
+    }
+    std::printf("cache memory: %zu bytes\n", asset->memoryUsage());
+
+    if (mainThreadState != nullptr)
+    {
+        PyEval_RestoreThread(mainThreadState);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,393 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "MockManagerInterface.hpp"
+
+#include <cctype>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <variant>
+
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <openassetio_mediacreation/traits/traits.hpp>
+
+namespace
+{
+using openassetio::errors::BatchElementError;
+using openassetio_mediacreation::traits::content::LocatableContentTrait;
+using openassetio_mediacreation::traits::identity::DisplayNameTrait;
+using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+using openassetio_mediacreation::traits::managementPolicy::ManagedTrait;
+
+constexpr const char* kPrefixSetting = "prefix";
+constexpr const char* kLatencySetting = "latency_us";
+constexpr const char* kJitterSetting = "jitter_us";
+constexpr const char* kErrorRateSetting = "error_rate";
+
+// Per thread, so that concurrent calls don't contend.
+std::minstd_rand& threadRandomEngine()
+{
+    thread_local std::minstd_rand engine{std::random_device{}()};
+    return engine;
+}
+
+// Settings from TOML may be integers or floats, interchangeably.
+double numericSetting(const openassetio::InfoDictionary& settings, const char* key)
+{
+    const auto& value = settings.at(key);
+    if (const auto* intValue = std::get_if<openassetio::Int>(&value))
+    {
+        return static_cast<double>(*intValue);
+    }
+    if (const auto* floatValue = std::get_if<openassetio::Float>(&value))
+    {
+        return *floatValue;
+    }
+    throw std::invalid_argument{std::string{"Mock manager setting '"} + key + "' must be a number"};
+}
+
+class EmptyPager : public openassetio::managerApi::EntityReferencePagerInterface
+{
+public:
+    bool hasNext(const openassetio::managerApi::HostSessionPtr&) override { return false; }
+    Page get(const openassetio::managerApi::HostSessionPtr&) override { return {}; }
+    void next(const openassetio::managerApi::HostSessionPtr&) override {}
+};
+
+// Percent-encode anything that isn't safe in a file URL path.
+std::string encodePath(const std::string_view str)
+{
+    constexpr const char* kHexDigits = "0123456789ABCDEF";
+    std::string encoded;
+    encoded.reserve(str.size());
+    for (const char chr : str)
+    {
+        const auto byte = static_cast<unsigned char>(chr);
+        if (std::isalnum(byte) != 0 || chr == '/' || chr == '-' || chr == '_' || chr == '.' ||
+            chr == '~')
+        {
+            encoded += chr;
+        }
+        else
+        {
+            encoded += '%';
+            encoded += kHexDigits[byte >> 4];
+            encoded += kHexDigits[byte & 0xF];
+        }
+    }
+    return encoded;
+}
+}  // namespace
+
+MockManagerInterface::MockManagerInterface(Options options) : _options{std::move(options)} {}
+
+openassetio::hostApi::ManagerPtr MockManagerInterface::makeManager(
+    Options options,
+    const openassetio::hostApi::HostInterfacePtr& hostInterface,
+    const openassetio::log::LoggerInterfacePtr& logger)
+{
+    using openassetio::managerApi::Host;
+    using openassetio::managerApi::HostSession;
+
+    auto manager = openassetio::hostApi::Manager::make(
+        std::make_shared<MockManagerInterface>(std::move(options)),
+        HostSession::make(Host::make(hostInterface), logger));
+    manager->initialize({});
+    return manager;
+}
+
+openassetio::Identifier MockManagerInterface::identifier() const
+{
+    return kIdentifier;
+}
+
+openassetio::Str MockManagerInterface::displayName() const
+{
+    return "KatanaOpenAssetIO Mock Manager";
+}
+
+openassetio::InfoDictionary MockManagerInterface::info()
+{
+    return {{openassetio::constants::kInfoKey_EntityReferencesMatchPrefix.data(),
+             _options.prefix}};
+}
+
+openassetio::InfoDictionary MockManagerInterface::settings(
+    const openassetio::managerApi::HostSessionPtr&)
+{
+    return {{kPrefixSetting, _options.prefix},
+            {kLatencySetting, static_cast<openassetio::Int>(_options.latency.count())},
+            {kJitterSetting, static_cast<openassetio::Int>(_options.jitter.count())},
+            {kErrorRateSetting, _options.errorRate}};
+}
+
+bool MockManagerInterface::hasCapability(const Capability capability)
+{
+    switch (capability)
+    {
+        case Capability::kEntityReferenceIdentification:
+        case Capability::kManagementPolicyQueries:
+        case Capability::kEntityTraitIntrospection:
+        case Capability::kResolution:
+        case Capability::kPublishing:
+        case Capability::kRelationshipQueries:
+        case Capability::kExistenceQueries:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void MockManagerInterface::initialize(openassetio::InfoDictionary managerSettings,
+                                      const openassetio::managerApi::HostSessionPtr&)
+{
+    // Unspecified settings keep their current values.
+    if (const auto prefixIt = managerSettings.find(kPrefixSetting);
+        prefixIt != managerSettings.end())
+    {
+        const auto* prefix = std::get_if<openassetio::Str>(&prefixIt->second);
+        if (prefix == nullptr || prefix->empty())
+        {
+            throw std::invalid_argument{"Mock manager setting 'prefix' must be a string"};
+        }
+        _options.prefix = *prefix;
+    }
+    if (managerSettings.count(kLatencySetting) != 0)
+    {
+        _options.latency = std::chrono::microseconds{
+            static_cast<std::int64_t>(numericSetting(managerSettings, kLatencySetting))};
+    }
+    if (managerSettings.count(kJitterSetting) != 0)
+    {
+        _options.jitter = std::chrono::microseconds{
+            static_cast<std::int64_t>(numericSetting(managerSettings, kJitterSetting))};
+    }
+    if (managerSettings.count(kErrorRateSetting) != 0)
+    {
+        const double errorRate = numericSetting(managerSettings, kErrorRateSetting);
+        if (errorRate < 0.0 || errorRate > 1.0)
+        {
+            throw std::invalid_argument{"Mock manager setting 'error_rate' must be from 0 to 1"};
+        }
+        _options.errorRate = errorRate;
+    }
+}
+
+openassetio::trait::TraitsDatas MockManagerInterface::managementPolicy(
+    const openassetio::trait::TraitSets& traitSets,
+    openassetio::access::PolicyAccess,
+    const openassetio::ContextConstPtr&,
+    const openassetio::managerApi::HostSessionPtr&)
+{
+    openassetio::trait::TraitsDatas policies;
+    policies.reserve(traitSets.size());
+    for (std::size_t idx = 0; idx < traitSets.size(); ++idx)
+    {
+        auto policy = openassetio::trait::TraitsData::make();
+        ManagedTrait{policy}.imbue();
+        LocatableContentTrait{policy}.imbue();
+        DisplayNameTrait{policy}.imbue();
+        VersionTrait{policy}.imbue();
+        policies.push_back(std::move(policy));
+    }
+    return policies;
+}
+
+bool MockManagerInterface::isEntityReferenceString(const openassetio::Str& someString,
+                                                   const openassetio::managerApi::HostSessionPtr&)
+{
+    return someString.rfind(_options.prefix, 0) == 0;
+}
+
+void MockManagerInterface::entityExists(const openassetio::EntityReferences& entityReferences,
+                                        const openassetio::ContextConstPtr&,
+                                        const openassetio::managerApi::HostSessionPtr&,
+                                        const ExistsSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback)
+{
+    simulateLatency();
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+    {
+        if (injectError())
+        {
+            errorCallback(idx,
+                          {BatchElementError::ErrorCode::kEntityAccessError, "Injected error"});
+            continue;
+        }
+        successCallback(idx, true);
+    }
+}
+
+void MockManagerInterface::entityTraits(const openassetio::EntityReferences& entityReferences,
+                                        openassetio::access::EntityTraitsAccess,
+                                        const openassetio::ContextConstPtr&,
+                                        const openassetio::managerApi::HostSessionPtr&,
+                                        const EntityTraitsSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback)
+{
+    simulateLatency();
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+    {
+        if (injectError())
+        {
+            errorCallback(idx,
+                          {BatchElementError::ErrorCode::kEntityAccessError, "Injected error"});
+            continue;
+        }
+        successCallback(idx,
+                        {LocatableContentTrait::kId, DisplayNameTrait::kId, VersionTrait::kId});
+    }
+}
+
+void MockManagerInterface::resolve(const openassetio::EntityReferences& entityReferences,
+                                   const openassetio::trait::TraitSet& traitSet,
+                                   openassetio::access::ResolveAccess,
+                                   const openassetio::ContextConstPtr&,
+                                   const openassetio::managerApi::HostSessionPtr&,
+                                   const ResolveSuccessCallback& successCallback,
+                                   const BatchElementErrorCallback& errorCallback)
+{
+    simulateLatency();
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+    {
+        if (injectError())
+        {
+            errorCallback(idx,
+                          {BatchElementError::ErrorCode::kEntityResolutionError, "Injected error"});
+            continue;
+        }
+        const std::string& ref = entityReferences[idx].toString();
+        const std::string_view name = std::string_view{ref}.substr(_options.prefix.size());
+
+        auto traitsData = openassetio::trait::TraitsData::make();
+        if (traitSet.count(LocatableContentTrait::kId) != 0)
+        {
+            LocatableContentTrait{traitsData}.setLocation("file:///mock/" + encodePath(name));
+        }
+        if (traitSet.count(DisplayNameTrait::kId) != 0)
+        {
+            DisplayNameTrait{traitsData}.setName(std::string{name});
+        }
+        if (traitSet.count(VersionTrait::kId) != 0)
+        {
+            VersionTrait versionTrait{traitsData};
+            versionTrait.setSpecifiedTag("1");
+            versionTrait.setStableTag("1");
+        }
+        successCallback(idx, std::move(traitsData));
+    }
+}
+
+void MockManagerInterface::getWithRelationship(
+    const openassetio::EntityReferences& entityReferences,
+    const openassetio::trait::TraitsDataPtr&,
+    const openassetio::trait::TraitSet&,
+    std::size_t,
+    openassetio::access::RelationsAccess,
+    const openassetio::ContextConstPtr&,
+    const openassetio::managerApi::HostSessionPtr&,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback)
+{
+    simulateLatency();
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+    {
+        if (injectError())
+        {
+            errorCallback(idx,
+                          {BatchElementError::ErrorCode::kEntityAccessError, "Injected error"});
+            continue;
+        }
+        successCallback(idx, std::make_shared<EmptyPager>());
+    }
+}
+
+void MockManagerInterface::getWithRelationships(
+    const openassetio::EntityReference&,
+    const openassetio::trait::TraitsDatas& relationshipTraitsDatas,
+    const openassetio::trait::TraitSet&,
+    std::size_t,
+    openassetio::access::RelationsAccess,
+    const openassetio::ContextConstPtr&,
+    const openassetio::managerApi::HostSessionPtr&,
+    const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback&)
+{
+    simulateLatency();
+    for (std::size_t idx = 0; idx < relationshipTraitsDatas.size(); ++idx)
+    {
+        successCallback(idx, std::make_shared<EmptyPager>());
+    }
+}
+
+void MockManagerInterface::preflight(const openassetio::EntityReferences& entityReferences,
+                                     const openassetio::trait::TraitsDatas&,
+                                     openassetio::access::PublishingAccess,
+                                     const openassetio::ContextConstPtr&,
+                                     const openassetio::managerApi::HostSessionPtr&,
+                                     const PreflightSuccessCallback& successCallback,
+                                     const BatchElementErrorCallback& errorCallback)
+{
+    simulateLatency();
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+    {
+        if (injectError())
+        {
+            errorCallback(idx,
+                          {BatchElementError::ErrorCode::kEntityAccessError, "Injected error"});
+            continue;
+        }
+        successCallback(idx, entityReferences[idx]);
+    }
+}
+
+void MockManagerInterface::register_(const openassetio::EntityReferences& entityReferences,
+                                     const openassetio::trait::TraitsDatas&,
+                                     openassetio::access::PublishingAccess,
+                                     const openassetio::ContextConstPtr&,
+                                     const openassetio::managerApi::HostSessionPtr&,
+                                     const RegisterSuccessCallback& successCallback,
+                                     const BatchElementErrorCallback& errorCallback)
+{
+    simulateLatency();
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+    {
+        if (injectError())
+        {
+            errorCallback(idx,
+                          {BatchElementError::ErrorCode::kEntityAccessError, "Injected error"});
+            continue;
+        }
+        successCallback(idx, entityReferences[idx]);
+    }
+}
+
+void MockManagerInterface::simulateLatency() const
+{
+    std::chrono::microseconds delay = _options.latency;
+    if (_options.jitter.count() > 0)
+    {
+        std::uniform_int_distribution<std::chrono::microseconds::rep> jitter{
+            0, _options.jitter.count()};
+        delay += std::chrono::microseconds{jitter(threadRandomEngine())};
+    }
+    if (delay.count() > 0)
+    {
+        std::this_thread::sleep_for(delay);
+    }
+}
+
+bool MockManagerInterface::injectError() const
+{
+    return _options.errorRate > 0 &&
+           std::bernoulli_distribution{_options.errorRate}(threadRandomEngine());
+}
@@ -0,0 +1,139 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+
+/**
+ * In-process manager that answers every query synthetically, for
+ * driving the plugin without an asset management system.
+ *
+ * Any string starting with the configured prefix is an entity
+ * reference. Each entity resolves to a location under file:///mock/
+ * derived from its reference, has a display name equal to the
+ * remainder of its reference after the prefix, and is at version "1".
+ * Relationship queries return no results, and publishing returns the
+ * input reference.
+ *
+ * Latency, with random jitter, and per-entity errors can be injected to
+ * simulate a real asset management system under load. When loaded as a
+ * plugin, these are configured by the manager settings `prefix`,
+ * `latency_us`, `jitter_us` and `error_rate`.
+ */
+class MockManagerInterface : public openassetio::managerApi::ManagerInterface
+{
+public:
+    struct Options
+    {
+        // Prefix identifying entity references.
+        std::string prefix{"mock://"};
+        // Simulated round trip time of each (batch) call.
+        std::chrono::microseconds latency{0};
+        // Maximum random delay added to the latency of each call.
+        std::chrono::microseconds jitter{0};
+        // Probability, from 0 to 1, of each entity in a call failing.
+        double errorRate{0.0};
+    };
+
+    static constexpr const char* kIdentifier = "org.katanaopenassetio.mock";
+
+    explicit MockManagerInterface(Options options);
+
+    /**
+     * Create a host-facing manager wrapping a new mock.
+     */
+    static openassetio::hostApi::ManagerPtr makeManager(
+        Options options,
+        const openassetio::hostApi::HostInterfacePtr& hostInterface,
+        const openassetio::log::LoggerInterfacePtr& logger);
+
+    [[nodiscard]] openassetio::Identifier identifier() const override;
+    [[nodiscard]] openassetio::Str displayName() const override;
+    openassetio::InfoDictionary info() override;
+    openassetio::InfoDictionary settings(
+        const openassetio::managerApi::HostSessionPtr& hostSession) override;
+    bool hasCapability(Capability capability) override;
+    void initialize(openassetio::InfoDictionary managerSettings,
+                    const openassetio::managerApi::HostSessionPtr& hostSession) override;
+
+    openassetio::trait::TraitsDatas managementPolicy(
+        const openassetio::trait::TraitSets& traitSets,
+        openassetio::access::PolicyAccess policyAccess,
+        const openassetio::ContextConstPtr& context,
+        const openassetio::managerApi::HostSessionPtr& hostSession) override;
+
+    bool isEntityReferenceString(
+        const openassetio::Str& someString,
+        const openassetio::managerApi::HostSessionPtr& hostSession) override;
+
+    void entityExists(const openassetio::EntityReferences& entityReferences,
+                      const openassetio::ContextConstPtr& context,
+                      const openassetio::managerApi::HostSessionPtr& hostSession,
+                      const ExistsSuccessCallback& successCallback,
+                      const BatchElementErrorCallback& errorCallback) override;
+
+    void entityTraits(const openassetio::EntityReferences& entityReferences,
+                      openassetio::access::EntityTraitsAccess entityTraitsAccess,
+                      const openassetio::ContextConstPtr& context,
+                      const openassetio::managerApi::HostSessionPtr& hostSession,
+                      const EntityTraitsSuccessCallback& successCallback,
+                      const BatchElementErrorCallback& errorCallback) override;
+
+    void resolve(const openassetio::EntityReferences& entityReferences,
+                 const openassetio::trait::TraitSet& traitSet,
+                 openassetio::access::ResolveAccess resolveAccess,
+                 const openassetio::ContextConstPtr& context,
+                 const openassetio::managerApi::HostSessionPtr& hostSession,
+                 const ResolveSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+
+    void getWithRelationship(const openassetio::EntityReferences& entityReferences,
+                             const openassetio::trait::TraitsDataPtr& relationshipTraitsData,
+                             const openassetio::trait::TraitSet& resultTraitSet,
+                             std::size_t pageSize,
+                             openassetio::access::RelationsAccess relationsAccess,
+                             const openassetio::ContextConstPtr& context,
+                             const openassetio::managerApi::HostSessionPtr& hostSession,
+                             const RelationshipQuerySuccessCallback& successCallback,
+                             const BatchElementErrorCallback& errorCallback) override;
+
+    void getWithRelationships(const openassetio::EntityReference& entityReference,
+                              const openassetio::trait::TraitsDatas& relationshipTraitsDatas,
+                              const openassetio::trait::TraitSet& resultTraitSet,
+                              std::size_t pageSize,
+                              openassetio::access::RelationsAccess relationsAccess,
+                              const openassetio::ContextConstPtr& context,
+                              const openassetio::managerApi::HostSessionPtr& hostSession,
+                              const RelationshipQuerySuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+
+    void preflight(const openassetio::EntityReferences& entityReferences,
+                   const openassetio::trait::TraitsDatas& traitsHints,
+                   openassetio::access::PublishingAccess publishingAccess,
+                   const openassetio::ContextConstPtr& context,
+                   const openassetio::managerApi::HostSessionPtr& hostSession,
+                   const PreflightSuccessCallback& successCallback,
+                   const BatchElementErrorCallback& errorCallback) override;
+
+    void register_(const openassetio::EntityReferences& entityReferences,
+                   const openassetio::trait::TraitsDatas& entityTraitsDatas,
+                   openassetio::access::PublishingAccess publishingAccess,
+                   const openassetio::ContextConstPtr& context,
+                   const openassetio::managerApi::HostSessionPtr& hostSession,
+                   const RegisterSuccessCallback& successCallback,
+                   const BatchElementErrorCallback& errorCallback) override;
+
+private:
+    void simulateLatency() const;
+    [[nodiscard]] bool injectError() const;
+
+    // Only modified by `initialize`, before the manager is used.
+    Options _options;
+};
@@ -0,0 +1,46 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// Exposes MockManagerInterface as an OpenAssetIO C++ plugin, such that
+// it can be selected by a manager configuration file (see
+// mock-manager.toml) in place of a real asset management system.
+#include <memory>
+
+#include <openassetio/pluginSystem/CppPluginSystemManagerPlugin.hpp>
+
+#include "MockManagerInterface.hpp"
+
+#if defined(_WIN32)
+#define KATANAOPENASSETIO_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define KATANAOPENASSETIO_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace
+{
+class MockManagerPlugin final : public openassetio::pluginSystem::CppPluginSystemManagerPlugin
+{
+public:
+    [[nodiscard]] openassetio::Identifier identifier() const override
+    {
+        return MockManagerInterface::kIdentifier;
+    }
+
+    // Options are replaced by any manager settings on initialization.
+    openassetio::managerApi::ManagerInterfacePtr interface() override
+    {
+        return std::make_shared<MockManagerInterface>(MockManagerInterface::Options{});
+    }
+};
+}  // namespace
+
+extern "C"
+{
+    KATANAOPENASSETIO_PLUGIN_EXPORT openassetio::pluginSystem::PluginFactory
+    openassetioPlugin() noexcept
+    {
+        return []() noexcept -> openassetio::pluginSystem::CppPluginSystemPluginPtr
+        { return std::make_shared<MockManagerPlugin>(); };
+    }
+}
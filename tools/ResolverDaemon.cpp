@@ -0,0 +1,562 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2024 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// katanaopenassetio-resolverd: a per-host resolver process owning the
+// OpenAssetIO manager and resolve cache on behalf of every Katana and
+// renderboot process that sets KATANAOPENASSETIO_RESOLVER_SOCKET.
+//
+// Usage: katanaopenassetio-resolverd [--socket PATH] [--cache-budget-mb MB] [--verbose]
+#include <Python.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <openassetio/access.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <openassetio_mediacreation/traits/traits.hpp>
+
+#include "Constants.hpp"
+#include "EntityCache.hpp"
+#include "Environment.hpp"
+#include "FileUrlPathConverter.hpp"
+#include "KatanaHostInterface.hpp"
+#include "ManagerLoader.hpp"
+#include "ResolverProtocol.hpp"
+
+namespace
+{
+std::atomic<bool> gStop{false};
+
+void handleSignal(int)
+{
+    gStop = true;
+}
+
+struct StderrLoggerInterface : openassetio::log::LoggerInterface
+{
+    explicit StderrLoggerInterface(const bool verbose) : _verbose{verbose} {}
+
+    void log(Severity severity, const openassetio::Str& message) override
+    {
+        if (!isSeverityLogged(severity))
+        {
+            return;
+        }
+        const std::lock_guard lock{_mutex};
+        std::cerr << "[katanaopenassetio-resolverd] " << message << "\n";
+    }
+
+    [[nodiscard]] bool isSeverityLogged(Severity severity) const override
+    {
+        return _verbose || severity >= Severity::kWarning;
+    }
+
+private:
+    const bool _verbose;
+    std::mutex _mutex;
+};
+
+/**
+ * Serves requests from plugin instances, backed by a single manager
+ * and cache shared by all connections.
+ */
+class ResolverService
+{
+public:
+    ResolverService(openassetio::hostApi::ManagerPtr manager,
+                    openassetio::log::LoggerInterfacePtr logger,
+                    const std::size_t cacheBudgetBytes)
+        : _manager{std::move(manager)},
+          _context{ManagerLoader::CreateContext(_manager, logger)},
+          _logger{std::move(logger)}
+    {
+        // Split as by the plugin.
+        _entityCache.setBudget(cacheBudgetBytes - cacheBudgetBytes / 8);
+        _fileUrlPathConverter.setBudget(cacheBudgetBytes / 8);
+
+        // Constant for the lifetime of the manager.
+        const auto info = _manager->info();
+        if (const auto prefixIt =
+                info.find(openassetio::constants::kInfoKey_EntityReferencesMatchPrefix.data());
+            prefixIt != info.end())
+        {
+            if (const auto* prefix = std::get_if<openassetio::Str>(&prefixIt->second))
+            {
+                _entityReferencePrefix = *prefix;
+            }
+        }
+    }
+
+    /**
+     * Serve requests on a connection, on a new thread, until the client
+     * disconnects. Takes ownership of the socket.
+     */
+    void startConnection(const int fd)
+    {
+        // Registered before the thread starts, so that shutdown() waits
+        // for it however soon it's called.
+        {
+            const std::lock_guard lock{_connectionsMutex};
+            _connections.push_back(fd);
+        }
+        try
+        {
+            std::thread{[this, fd] { serveConnection(fd); }}.detach();
+        }
+        catch (const std::system_error& exc)
+        {
+            _logger->log(Severity::kWarning,
+                         std::string{"Failed to start connection thread: "} + exc.what());
+            const std::lock_guard lock{_connectionsMutex};
+            _connections.erase(std::find(_connections.begin(), _connections.end(), fd));
+            ::close(fd);
+        }
+    }
+
+    /**
+     * Disconnect all clients and wait for their threads to finish.
+     */
+    void shutdown()
+    {
+        std::unique_lock lock{_connectionsMutex};
+        for (const int fd : _connections)
+        {
+            ::shutdown(fd, SHUT_RDWR);
+        }
+        _connectionsChanged.wait(lock, [this] { return _connections.empty(); });
+    }
+
+private:
+    using Severity = openassetio::log::LoggerInterface::Severity;
+
+    void serveConnection(const int fd)
+    {
+        serveRequests(fd);
+
+        const std::lock_guard lock{_connectionsMutex};
+        _connections.erase(std::find(_connections.begin(), _connections.end(), fd));
+        ::close(fd);
+        // Whilst holding the lock, as once it is released, shutdown()
+        // may return and the service (and this condition variable) be
+        // destroyed.
+        _connectionsChanged.notify_all();
+    }
+
+    void serveRequests(const int fd)
+    {
+        ResolverProtocol::Header header{};
+        std::string request;
+        std::string response;
+        std::vector<std::string_view> items;
+        std::vector<ResolverProtocol::Result> results;
+
+        while (!gStop && ResolverProtocol::ReadMessage(fd, header, request))
+        {
+            if (!ResolverProtocol::DecodeRequest(header, request, items))
+            {
+                _logger->log(Severity::kWarning, "Malformed request - closing connection");
+                return;
+            }
+            switch (header.type)
+            {
+            case ResolverProtocol::MessageType::kResolveLocations:
+                resolveLocations(items, results);
+                break;
+            case ResolverProtocol::MessageType::kFlush:
+                _entityCache.clear();
+                _fileUrlPathConverter.clear();
+                // As the plugin would its own manager.
+                flushManagerCaches();
+                results.clear();
+                break;
+            case ResolverProtocol::MessageType::kEntityReferencePrefix:
+                results.assign(1, {});
+                if (_entityReferencePrefix)
+                {
+                    results.front() = {ResolverProtocol::Status::kOk, *_entityReferencePrefix};
+                }
+                else
+                {
+                    results.front().value = "Manager does not provide an entity reference prefix";
+                }
+                break;
+            default:
+                _logger->log(Severity::kWarning, "Unknown request type - closing connection");
+                return;
+            }
+            ResolverProtocol::EncodeResults(results, response);
+            if (!ResolverProtocol::WriteMessage(fd, response))
+            {
+                return;
+            }
+        }
+    }
+
+    void flushManagerCaches()
+    {
+        try
+        {
+            _manager->flushCaches();
+        }
+        catch (const std::exception& exc)
+        {
+            _logger->log(Severity::kWarning,
+                         std::string{"Failed to flush manager caches: "} + exc.what());
+        }
+    }
+
+    void resolveLocations(const std::vector<std::string_view>& assetIds,
+                          std::vector<ResolverProtocol::Result>& results)
+    {
+        using openassetio::access::ResolveAccess;
+        using openassetio::errors::BatchElementError;
+        using openassetio_mediacreation::traits::content::LocatableContentTrait;
+        using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+        using ResolverProtocol::Status;
+
+        results.assign(assetIds.size(), {});
+
+        // Serve what we can from the cache, and batch the rest into a
+        // single manager call.
+        openassetio::EntityReferences entityRefs;
+        std::vector<std::size_t> resultIdxs;
+        for (std::size_t idx = 0; idx < assetIds.size(); ++idx)
+        {
+            if (_entityCache.get(
+                    assetIds[idx], EntityCache::Field::kLocation, results[idx].value))
+            {
+                results[idx].status = Status::kOk;
+                continue;
+            }
+            auto entityRef = _manager->createEntityReferenceIfValid(std::string{assetIds[idx]});
+            if (!entityRef)
+            {
+                results[idx].value =
+                    std::string{assetIds[idx]} + " is not a valid entity reference";
+                continue;
+            }
+            entityRefs.push_back(std::move(*entityRef));
+            resultIdxs.push_back(idx);
+        }
+        if (entityRefs.empty())
+        {
+            return;
+        }
+
+        try
+        {
+            _manager->resolve(
+                entityRefs,
+                // With the version, to tell whether the location may
+                // be cached.
+                {LocatableContentTrait::kId, VersionTrait::kId},
+                ResolveAccess::kRead,
+                _context,
+                [&](const std::size_t idx, const openassetio::trait::TraitsDataPtr& traitsData)
+                {
+                    ResolverProtocol::Result& result = results[resultIdxs[idx]];
+                    const auto url = LocatableContentTrait(traitsData).getLocation();
+                    if (!url)
+                    {
+                        result.value = entityRefs[idx].toString() + " has no location";
+                        return;
+                    }
+                    try
+                    {
+                        _fileUrlPathConverter.pathFromUrl(*url, result.value);
+                        // As in the plugin, a meta-version's location
+                        // changes when another version is published.
+                        const VersionTrait versionTrait{traitsData};
+                        const auto specifiedTag = versionTrait.getSpecifiedTag();
+                        if (!specifiedTag || specifiedTag != versionTrait.getStableTag())
+                        {
+                            result.status = Status::kOkVolatile;
+                            return;
+                        }
+                        result.status = Status::kOk;
+                        _entityCache.put(
+                            assetIds[resultIdxs[idx]], EntityCache::Field::kLocation, result.value);
+                    }
+                    catch (const std::exception& exc)
+                    {
+                        result.value = exc.what();
+                    }
+                },
+                [&](const std::size_t idx, const BatchElementError& error)
+                { results[resultIdxs[idx]].value = error.message; });
+        }
+        catch (const std::exception& exc)
+        {
+            for (const std::size_t idx : resultIdxs)
+            {
+                results[idx] = {Status::kError, exc.what()};
+            }
+        }
+    }
+
+    openassetio::hostApi::ManagerPtr _manager;
+    openassetio::ContextPtr _context;
+    openassetio::log::LoggerInterfacePtr _logger;
+    std::optional<std::string> _entityReferencePrefix;
+    EntityCache _entityCache;
+    CachingFileUrlPathConverter _fileUrlPathConverter;
+
+    std::mutex _connectionsMutex;
+    std::condition_variable _connectionsChanged;
+    std::vector<int> _connections;
+};
+
+// Ensures the socket's directory exists, creating it if need be, and
+// that only the current user can create or replace files in it.
+bool prepareSocketDirectory(const std::string& socketPath)
+{
+    const std::size_t slashPos = socketPath.rfind('/');
+    const std::string directory = slashPos == std::string::npos
+                                      ? "."
+                                      : socketPath.substr(0, std::max<std::size_t>(slashPos, 1));
+    if (::mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST)
+    {
+        std::perror(("mkdir " + directory).c_str());
+        return false;
+    }
+    struct stat status{};
+    if (::lstat(directory.c_str(), &status) != 0 || !S_ISDIR(status.st_mode) ||
+        status.st_uid != ::geteuid() || (status.st_mode & (S_IWGRP | S_IWOTH)) != 0)
+    {
+        std::cerr << "Socket directory must be owned by, and only writable by, the current "
+                     "user: "
+                  << directory << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Removes a socket left by a previous instance, but nothing else, and
+// not one that another instance is still listening on.
+bool removeStaleSocket(const sockaddr_un& address)
+{
+    struct stat status{};
+    if (::lstat(address.sun_path, &status) != 0)
+    {
+        return errno == ENOENT;
+    }
+    if (!S_ISSOCK(status.st_mode) || status.st_uid != ::geteuid())
+    {
+        std::cerr << "Refusing to replace " << address.sun_path << "\n";
+        return false;
+    }
+    const int probeFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    const bool live =
+        probeFd >= 0 &&
+        ::connect(probeFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+    if (probeFd >= 0)
+    {
+        ::close(probeFd);
+    }
+    if (live)
+    {
+        std::cerr << "Already running on " << address.sun_path << "\n";
+        return false;
+    }
+    return ::unlink(address.sun_path) == 0;
+}
+
+std::optional<std::size_t> parseUnsigned(const char* str)
+{
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long value = std::strtoull(str, &end, 10);
+    if (end == str || *end != '\0' || errno != 0 || *str == '-')
+    {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(value);
+}
+
+int listenOn(const std::string& socketPath)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        std::cerr << "Socket path too long: " << socketPath << "\n";
+        return -1;
+    }
+    std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+    if (!prepareSocketDirectory(socketPath) || !removeStaleSocket(address))
+    {
+        return -1;
+    }
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        std::perror("socket");
+        return -1;
+    }
+    // Only the current user may connect.
+    const mode_t oldMask = ::umask(0077);
+    const int bindResult = ::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+    ::umask(oldMask);
+    if (bindResult != 0 || ::listen(fd, SOMAXCONN) != 0)
+    {
+        std::perror("bind/listen");
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string socketPath = Environment::GetString(Constants::kResolverSocketEnvVar)
+                                 .value_or(ResolverProtocol::DefaultSocketPath());
+    std::size_t cacheBudgetMegabytes = Environment::GetUnsigned(
+        Constants::kCacheBudgetEnvVar, Constants::kDefaultResolverCacheBudgetMegabytes);
+    bool verbose = false;
+    const auto usage = [argv]
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--socket PATH] [--cache-budget-mb MB] [--verbose]\n";
+        return EXIT_FAILURE;
+    };
+    for (int argIdx = 1; argIdx < argc; ++argIdx)
+    {
+        const std::string_view arg{argv[argIdx]};
+        if (arg == "--socket" && argIdx + 1 < argc)
+        {
+            socketPath = argv[++argIdx];
+        }
+        else if (arg == "--cache-budget-mb" && argIdx + 1 < argc)
+        {
+            const auto megabytes = parseUnsigned(argv[++argIdx]);
+            if (!megabytes)
+            {
+                return usage();
+            }
+            cacheBudgetMegabytes = *megabytes;
+        }
+        else if (arg == "--verbose")
+        {
+            verbose = true;
+        }
+        else
+        {
+            return usage();
+        }
+    }
+    // Unlike the plugin, zero doesn't mean unlimited, as the daemon
+    // outlives the sessions it serves.
+    if (cacheBudgetMegabytes == 0)
+    {
+        cacheBudgetMegabytes = Constants::kDefaultResolverCacheBudgetMegabytes;
+    }
+
+    const auto logger = std::make_shared<StderrLoggerInterface>(verbose);
+
+    // Unlike inside Katana, nothing else will have started Python.
+    const bool usePython = !Environment::IsFlagSet(Constants::kDisablePythonEnvVar);
+    if (usePython && !Py_IsInitialized())
+    {
+        Py_InitializeEx(0);
+    }
+
+    std::unique_ptr<ResolverService> service;
+    try
+    {
+        service = std::make_unique<ResolverService>(
+            ManagerLoader::LoadDefaultManager(std::make_shared<KatanaHostInterface>(), logger),
+            logger,
+            cacheBudgetMegabytes * 1024 * 1024);
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << exc.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    const int listenFd = listenOn(socketPath);
+    if (listenFd < 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    logger->log(openassetio::log::LoggerInterface::Severity::kInfo,
+                "Listening on " + socketPath);
+
+    // Release the GIL, so that connection threads can acquire it when
+    // calling into a Python manager.
+    PyThreadState* const mainThreadState = usePython ? PyEval_SaveThread() : nullptr;
+
+    // One thread per connection. Clients hold a small pool of
+    // long-lived connections, so this stays modest.
+    while (!gStop)
+    {
+        pollfd pollFd{listenFd, POLLIN, 0};
+        // Wake periodically to check for shutdown.
+        if (::poll(&pollFd, 1, 500) <= 0)
+        {
+            continue;
+        }
+        const int connectionFd = ::accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (connectionFd < 0)
+        {
+            continue;
+        }
+        // The socket's permissions should already ensure this.
+        if (!ResolverProtocol::IsPeerCurrentUser(connectionFd))
+        {
+            logger->log(openassetio::log::LoggerInterface::Severity::kWarning,
+                        "Refusing connection from another user");
+            ::close(connectionFd);
+            continue;
+        }
+        service->startConnection(connectionFd);
+    }
+
+    ::close(listenFd);
+    ::unlink(socketPath.c_str());
+    service->shutdown();
+
+    if (mainThreadState != nullptr)
+    {
+        PyEval_RestoreThread(mainThreadState);
+    }
+    // Release the manager whilst holding the GIL.
+    service.reset();
+    return EXIT_SUCCESS;
+}